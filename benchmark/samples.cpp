@@ -0,0 +1,35 @@
+#include "ui_bench_table.h"
+#include "ui_bench_list.h"
+
+// Synthetic data for the sample designs, used by template/benchmark/main.cpp
+// when it is built with IMRAD_BENCHMARK_SAMPLES
+
+void Setup(int size)
+{
+	benchTable.rows.resize(size);
+	for (int i = 0; i < size; ++i)
+	{
+		auto& row = benchTable.rows[i];
+		row.id = i;
+		row.name = "item " + std::to_string(i);
+		row.value = (i * 37 % 1000) / 10.f;
+	}
+	benchTable.selected = size / 2;
+	benchTable.Open();
+
+	benchList.items.resize(size);
+	for (int i = 0; i < size; ++i)
+	{
+		auto& item = benchList.items[i];
+		item.checked = i % 3 == 0;
+		item.text = "note " + std::to_string(i) +
+			std::string(i % 7 * 12, 'x') + " wrapped when it gets longer than the column";
+	}
+	benchList.Open();
+}
+
+void Draw()
+{
+	benchTable.Draw();
+	benchList.Draw();
+}
@@ -0,0 +1,73 @@
+// Generated with ImRAD 0.9
+// visit github.com/tpecholt/imrad
+
+#include "ui_bench_list.h"
+
+BenchList benchList;
+
+
+void BenchList::Open()
+{
+    isOpen = true;
+}
+
+void BenchList::Close()
+{
+    isOpen = false;
+}
+
+void BenchList::Draw()
+{
+    /// @style Dark
+    /// @unit px
+    /// @begin TopWindow
+    IMRAD_PROFILE_SCOPE("BenchList");
+    ImGui::SetNextWindowSize({ 400, 600 }, ImGuiCond_FirstUseEver); //{ 400, 600 }
+    ImGui::SetNextWindowSizeConstraints({ 0, 0 }, { FLT_MAX, FLT_MAX });
+    if (isOpen && ImGui::Begin("List###BenchList", &isOpen, ImGuiWindowFlags_NoCollapse))
+    {
+        /// @separator
+
+        // TODO: Add Draw calls of dependent popup windows here
+
+        /// @begin Table
+        {
+            IMRAD_PROFILE_SCOPE("BenchList/Table 0");
+            if (ImGui::BeginTable("table1", 2, ImGuiTableFlags_BordersInnerH | ImGuiTableFlags_ScrollY, { -1, -1 }))
+            {
+                ImGui::TableSetupColumn("A", ImGuiTableColumnFlags_WidthFixed, 30);
+                ImGui::TableSetupColumn("B", ImGuiTableColumnFlags_WidthStretch, 0);
+                ImGui::TableSetupScrollFreeze(0, 0);
+
+                for (int i = 0; i < items.size(); ++i)
+                {
+                    auto& _item = items[i];
+                    ImGui::PushID(i);
+                    ImGui::TableNextRow(0, 0);
+                    ImGui::TableSetColumnIndex(0);
+                    /// @separator
+
+                    /// @begin CheckBox
+                    ImGui::Checkbox("##checked", &_item.checked);
+                    /// @end CheckBox
+
+                    /// @begin Text
+                    ImRad::TableNextColumn(1);
+                    ImGui::PushTextWrapPos(0);
+                    ImRad::TextWrapCached(ImRad::Format("{}", _item.text).c_str());
+                    ImGui::PopTextWrapPos();
+                    /// @end Text
+
+                    /// @separator
+                    ImGui::PopID();
+                }
+                ImGui::EndTable();
+            }
+        }
+        /// @end Table
+
+        /// @separator
+        ImGui::End();
+    }
+    /// @end TopWindow
+}
@@ -0,0 +1,29 @@
+// Generated with ImRAD 0.9
+// visit github.com/tpecholt/imrad
+
+#pragma once
+#include "imrad.h"
+
+class BenchList
+{
+public:
+    /// @begin interface
+    void Open();
+    void Close();
+    void Draw();
+
+    struct Item {
+        bool checked;
+        std::string text;
+    };
+
+    std::vector<Item> items;
+    /// @end interface
+
+private:
+    /// @begin impl
+    bool isOpen = true;
+    /// @end impl
+};
+
+extern BenchList benchList;
@@ -0,0 +1,80 @@
+// Generated with ImRAD 0.9
+// visit github.com/tpecholt/imrad
+
+#include "ui_bench_table.h"
+
+BenchTable benchTable;
+
+
+void BenchTable::Open()
+{
+    isOpen = true;
+}
+
+void BenchTable::Close()
+{
+    isOpen = false;
+}
+
+void BenchTable::Draw()
+{
+    /// @style Dark
+    /// @unit px
+    /// @begin TopWindow
+    IMRAD_PROFILE_SCOPE("BenchTable");
+    ImGui::SetNextWindowSize({ 640, 480 }, ImGuiCond_FirstUseEver); //{ 640, 480 }
+    ImGui::SetNextWindowSizeConstraints({ 0, 0 }, { FLT_MAX, FLT_MAX });
+    if (isOpen && ImGui::Begin("Table###BenchTable", &isOpen, ImGuiWindowFlags_NoCollapse))
+    {
+        /// @separator
+
+        // TODO: Add Draw calls of dependent popup windows here
+
+        /// @begin Table
+        {
+            IMRAD_PROFILE_SCOPE("BenchTable/Table 0");
+            if (ImGui::BeginTable("table1", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY, { -1, -1 }))
+            {
+                ImGui::TableSetupColumn("ID", ImGuiTableColumnFlags_WidthFixed, 60);
+                ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch, 0);
+                ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_WidthFixed, 100);
+                ImGui::TableSetupScrollFreeze(0, 1);
+                ImGui::TableHeadersRow();
+
+                for (int i : ImRad::ClipRange(rows.size()))
+                {
+                    auto& _item = rows[i];
+                    ImGui::PushID(i);
+                    ImGui::TableNextRow(0, 0);
+                    ImGui::TableSetColumnIndex(0);
+                    /// @separator
+
+                    /// @begin Selectable
+                    ImGui::PushStyleVar(ImGuiStyleVar_SelectableTextAlign, { 0, 0 });
+                    ImRad::Selectable(ImRad::Format("{}", _item.id).c_str(), i == selected, ImGuiSelectableFlags_NoAutoClosePopups | ImGuiSelectableFlags_SpanAllColumns, { 0, 0 });
+                    ImGui::PopStyleVar();
+                    /// @end Selectable
+
+                    /// @begin Text
+                    ImRad::TableNextColumn(1);
+                    ImGui::TextUnformatted(ImRad::Format("{}", _item.name).c_str());
+                    /// @end Text
+
+                    /// @begin Text
+                    ImRad::TableNextColumn(1);
+                    ImGui::TextUnformatted(ImRad::Format("{}", _item.value).c_str());
+                    /// @end Text
+
+                    /// @separator
+                    ImGui::PopID();
+                }
+                ImGui::EndTable();
+            }
+        }
+        /// @end Table
+
+        /// @separator
+        ImGui::End();
+    }
+    /// @end TopWindow
+}
@@ -0,0 +1,31 @@
+// Generated with ImRAD 0.9
+// visit github.com/tpecholt/imrad
+
+#pragma once
+#include "imrad.h"
+
+class BenchTable
+{
+public:
+    /// @begin interface
+    void Open();
+    void Close();
+    void Draw();
+
+    struct Row {
+        int id;
+        std::string name;
+        float value;
+    };
+
+    std::vector<Row> rows;
+    int selected = -1;
+    /// @end interface
+
+private:
+    /// @begin impl
+    bool isOpen = true;
+    /// @end impl
+};
+
+extern BenchTable benchTable;
@@ -13,6 +13,7 @@
 #include "ui_combo_dlg.h"
 
 inline const char* PARENT_STR = "inherit";
+inline const char* ASYNC_EVENT_TYPE = "ImRad::Task()";
 inline const uint32_t NONE_COLOR = 0xff800000;
 inline const uint32_t NEW_COLOR = 0xff006000;
 inline const uint32_t RENAME_COLOR = 0xff004080;
@@ -48,7 +49,7 @@ inline bool BindingButton(const char* label, bindable<T>* val, const std::string
         std::is_same_v<T, std::vector<std::string>> ||
         std::is_same_v<T, color_t>)
     {
-        bound = !val->used_variables().empty();
+        bound = !val->used_vars().empty();
     }
     else if constexpr (std::is_same_v<T, bool>)
         bound = !val->empty(); //the default value is usually empty
@@ -335,7 +336,7 @@ inline bool InputDirectValEnum(direct_val<T, true>* val, int fl, UIContext& ctx)
                 else
                     pre = 0;
             }
-            if (ImGui::Selectable(item.first.c_str() + pre, *val->access() == item.second))
+            if (ImGui::Selectable(item.first.data() + pre, *val->access() == item.second))
                 *val->access() = item.second;
         }
         ImGui::EndCombo();
@@ -377,7 +378,7 @@ inline int InputDirectValFlags(const char* name, direct_val<T, true>* val, int d
                     pre = 0;
             }
             ImU64 flags = *val;
-            if (ImGui::CheckboxFlags(id.first.c_str() + pre, &flags, id.second)) {
+            if (ImGui::CheckboxFlags(id.first.data() + pre, &flags, id.second)) {
                 changed = id.second;
                 *val->access() = (int)flags;
             }
@@ -403,7 +404,8 @@ inline int InputDirectValFlags(const char* name, direct_val<T, true>* val, int d
                     if (i != std::string::npos && i + 1 < id.first.size())
                         pre = i + 1;
                 }
-                tip += id.first.substr(pre) + "\n";
+                tip += id.first.substr(pre);
+                tip += "\n";
             }
         }
         if (tip == "")
@@ -506,12 +508,13 @@ inline bool InputBindable(bindable<T>* val, const std::string& type, int flags,
             ImGui::PushStyleColor(ImGuiCol_Text, RENAME_COLOR);
             if (val->has_single_variable() && ImGui::Selectable("Rename..."))
             {
-                auto vars = val->used_variables();
+                const auto& vars = val->used_vars();
                 newFieldPopup.codeGen = ctx.codeGen;
                 newFieldPopup.varOldName = vars[0];
                 newFieldPopup.mode = NewFieldPopup::RenameField;
-                newFieldPopup.OpenPopup([val, root = ctx.root]{
+                newFieldPopup.OpenPopup([val, &ctx, root = ctx.root]{
                     root->RenameFieldVars(newFieldPopup.varOldName, newFieldPopup.varName);
+                    *ctx.modified = true;
                     });
             }
             ImGui::PopStyleColor();
@@ -533,7 +536,7 @@ inline bool InputBindable(bindable<T>* val, const std::string& type, int flags,
             auto vars = ctx.codeGen->GetVarExprs(type, true, ctx.GetCurrentArray());
             /*auto* dc = ImGui::GetCurrentWindow()->DrawList;
             float sp = ImGui::CalcTextSize(" ").x;*/ 
-            for (const auto& v : vars)
+            for (const auto& v : *vars)
             {
                 if (ImGui::Selectable(v.first.c_str(), v.first == val->c_str()))
                 {
@@ -880,7 +883,7 @@ inline bool InputBindable(bindable<std::vector<std::string>>* val, UIContext& ct
     if (!val->has_single_variable())
         label = "[" + std::to_string(nl) + "]";
     else
-        label = val->used_variables()[0];
+        label = val->used_vars()[0];
     label += id;
 
     ImGui::PushFont(!ImRad::IsCurrentItemDisabled() && !val->empty() ?
@@ -947,8 +950,8 @@ inline bool InputBindable(bindable<std::vector<std::string>>* val, UIContext& ct
         ImGui::PopStyleColor();
 
         ImGui::Separator();
-        const auto& vars = ctx.codeGen->GetVarExprs("std::vector<std::string>", true, ctx.GetCurrentArray());
-        for (const auto& v : vars)
+        auto vars = ctx.codeGen->GetVarExprs("std::vector<std::string>", true, ctx.GetCurrentArray());
+        for (const auto& v : *vars)
         {
             if (ImGui::Selectable(v.first.c_str(), '{' + v.first + '}' == val->c_str()))
             {
@@ -1078,13 +1081,14 @@ inline bool InputFieldRef(field_ref<T>* val, const std::string& type, bool allow
         ImGui::PushStyleColor(ImGuiCol_Text, RENAME_COLOR);
         if (val->has_single_variable() && ImGui::Selectable("Rename..."))
         {
-            auto vars = val->used_variables();
+            const auto& vars = val->used_vars();
             assert(vars.size() == 1);
             newFieldPopup.codeGen = ctx.codeGen;
             newFieldPopup.varOldName = vars[0];
             newFieldPopup.mode = NewFieldPopup::RenameField;
-            newFieldPopup.OpenPopup([val, root=ctx.root] {
+            newFieldPopup.OpenPopup([val, &ctx, root=ctx.root] {
                 root->RenameFieldVars(newFieldPopup.varOldName, newFieldPopup.varName);
+                *ctx.modified = true;
                 });
         }
         ImGui::PopStyleColor();
@@ -1104,7 +1108,7 @@ inline bool InputFieldRef(field_ref<T>* val, const std::string& type, bool allow
 
         ImGui::Separator();
         auto vars = ctx.codeGen->GetVarExprs(type, true, ctx.GetCurrentArray());
-        for (const auto& v : vars)
+        for (const auto& v : *vars)
         {
             if (ImGui::Selectable(v.first.c_str(), v.first == val->c_str()))
             {
@@ -1177,8 +1181,8 @@ inline bool InputDataSize(bindable<int>* val, bool allowEmpty, UIContext& ctx)
         */
 
         ImGui::Separator();
-        const auto& vars = ctx.codeGen->GetVarExprs("int", false);
-        for (const auto& v : vars)
+        auto vars = ctx.codeGen->GetVarExprs("int", false);
+        for (const auto& v : *vars)
         {
             if (ImGui::Selectable(v.first.c_str(), v.first == val->c_str()))
             {
@@ -1255,12 +1259,24 @@ inline bool InputEvent(const std::string& name, event<FuncSig>* val, int flags,
                     ctx.setPropValue = newFieldPopup.varName;
                     });
             }
+            //handlers without arguments can run as coroutines
+            if (type == "void()" && ImGui::Selectable("New Async Method..."))
+            {
+                newFieldPopup.varType = ASYNC_EVENT_TYPE;
+                newFieldPopup.varName = name;
+                newFieldPopup.codeGen = ctx.codeGen;
+                newFieldPopup.mode = NewFieldPopup::NewEvent;
+                newFieldPopup.OpenPopup([&ctx, val] {
+                    ctx.setProp = val;
+                    ctx.setPropValue = newFieldPopup.varName;
+                    });
+            }
             ImGui::PopStyleColor();
 
             ImGui::Separator();
             std::vector<std::string> events;
             for (const auto& v : ctx.codeGen->GetVars()) {
-                if (v.type == type)
+                if (v.type == type || (type == "void()" && v.type == ASYNC_EVENT_TYPE))
                     events.push_back(v.name);
             }
             stx::sort(events);
@@ -1,6 +1,10 @@
 #pragma once
 #include <string>
 #include <vector>
+#include <memory>
+#include <map>
+#include <mutex>
+#include <tuple>
 #include <sstream>
 #include <iomanip>
 #include <imgui.h>
@@ -18,6 +22,41 @@ struct property_base
     virtual const char* c_str() const = 0;
     virtual std::vector<std::string> used_variables() const = 0;
     virtual void rename_variable(const std::string& oldn, const std::string& newn) = 0;
+    //hash of the expression text the used_vars cache is keyed on, 0 when empty
+    virtual uint64_t var_hash() const {
+        const char* s = c_str();
+        return s && *s ? HashContent(s) : 0;
+    }
+
+    //used_variables parsed again only when the expression changes
+    //unbound properties keep no cache so they cost a single pointer
+    const std::vector<std::string>& used_vars() const {
+        static const std::vector<std::string> none;
+        uint64_t hash = var_hash();
+        if (!hash)
+            return none;
+        if (!m_used || m_used->hash != hash)
+            m_used.reset(new used_cache{ hash, used_variables() });
+        return m_used->vars;
+    }
+    bool uses_variable(std::string_view var) const {
+        return stx::count(used_vars(), var);
+    }
+
+    property_base() = default;
+    property_base(const property_base&) {}
+    property_base& operator= (const property_base&) {
+        m_used.reset();
+        return *this;
+    }
+
+private:
+    struct used_cache
+    {
+        uint64_t hash;
+        std::vector<std::string> vars;
+    };
+    mutable std::unique_ptr<used_cache> m_used;
 };
 
 //member variable expression like id, id.member, id[0], id.size()
@@ -149,37 +188,62 @@ private:
     T val;
 };
 
+//ids are string literals so entries don't allocate
+using id_table = std::vector<std::pair<std::string_view, int>>;
+
+inline std::shared_ptr<const id_table> empty_id_table()
+{
+    static const auto tab = std::make_shared<const id_table>();
+    return tab;
+}
+
+//option tables are immutable and interned by the sequence of add calls so all
+//widgets of a type end up sharing the tables built by the first instance
+//guarded because files can be imported from worker threads
+inline std::shared_ptr<const id_table> extend_id_table(const std::shared_ptr<const id_table>& tab, const char* id, int v)
+{
+    static std::mutex mutex;
+    static std::map<std::tuple<const id_table*, const char*, int>, std::shared_ptr<const id_table>> cache;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& next = cache[{ tab.get(), id, v }];
+    if (!next) {
+        auto ext = std::make_shared<id_table>(*tab);
+        ext->push_back({ id, v });
+        next = std::move(ext);
+    }
+    return next;
+}
+
 #define add$(f) add(#f, f)
 template <class T>
 struct direct_val<T, true> : property_base
 {
-    direct_val(int v = 0) : val(v) {}
+    direct_val(int v = 0) : val(v), ids(empty_id_table()) {}
 
     void clear() {
-        ids.clear();
+        ids = empty_id_table();
     }
     direct_val& add(const char* id, int v) {
-        ids.push_back({ id, v });
+        ids = extend_id_table(ids, id, v);
         return *this;
     }
     direct_val& separator() {
-        ids.push_back({ "", 0 });
+        ids = extend_id_table(ids, "", 0);
         return *this;
     }
     auto find_id(int fl) const {
-        return stx::find_if(ids, [this,fl](const auto& id) {
+        return stx::find_if(*ids, [this,fl](const auto& id) {
             return id.first != "" && id.second == fl;
             });
     }
-    const auto& get_ids() const { return ids; }
-    const std::string& get_id() const {
-        static std::string none;
+    const id_table& get_ids() const { return *ids; }
+    std::string get_id() const {
         auto it = find_id(val);
-        return it != ids.end() ? it->first : none;
+        return it != ids->end() ? std::string(it->first) : "";
     }
     void set_id(const std::string& v) {
-        auto it = stx::find_if(ids, [&v](const auto& id) { return id.first == v; });
-        if (it != ids.end())
+        auto it = stx::find_if(*ids, [&v](const auto& id) { return id.first == v; });
+        if (it != ids->end())
             val = it->second;
     }
 
@@ -208,12 +272,12 @@ struct direct_val<T, true> : property_base
                 s = str.substr(i);
             else
                 s = str.substr(i, j - i);
-            auto id = stx::find_if(ids, [&](const auto& id) { return id.first == s; });
-            //assert(id != ids.end());
+            auto id = stx::find_if(*ids, [&](const auto& id) { return id.first == s; });
+            //assert(id != ids->end());
             if (s == "0" ||
                 (!s.compare(0, 5, "ImGui") && !s.compare(s.size() - 5, 5, "_None")))
                 val;
-            else if (id != ids.end())
+            else if (id != ids->end())
                 val |= id->second;
             else
                 ok = false;
@@ -226,18 +290,20 @@ struct direct_val<T, true> : property_base
     std::string to_arg(std::string_view = "", std::string_view = "") const {
         std::string str;
         bool simpleEnum = false;
-        for (const auto& id : ids) {
+        for (const auto& id : *ids) {
             if (id.first != "" && !id.second)
                 simpleEnum = true;
         }
         if (simpleEnum) {
-            auto it = stx::find_if(ids, [this](const auto& id) { return id.second == val; });
-            str = it == ids.end() ? "0" : it->first;
+            auto it = stx::find_if(*ids, [this](const auto& id) { return id.second == val; });
+            str = it == ids->end() ? "0" : std::string(it->first);
         }
         else {
-            for (const auto& id : ids)
-                if ((val & id.second) == id.second && id.first != "")
-                    str += id.first + " | ";
+            for (const auto& id : *ids)
+                if ((val & id.second) == id.second && id.first != "") {
+                    str += id.first;
+                    str += " | ";
+                }
             if (str != "")
                 str.resize(str.size() - 3);
             else
@@ -255,7 +321,7 @@ struct direct_val<T, true> : property_base
 
 private:
     int val;
-    std::vector<std::pair<std::string, int>> ids;
+    std::shared_ptr<const id_table> ids;
 };
 
 template <>
@@ -784,7 +850,7 @@ struct bindable<std::string> : property_base
     bool has_single_variable() const {
         if (empty() || str[0] != '{' || str.back() != '}')
             return false;
-        auto vars = used_variables();
+        const auto& vars = used_vars();
         if (vars.size() != 1 || str.compare(1, str.size() - 2, vars[0]))
             return false;
         return true;
@@ -1036,6 +1102,7 @@ struct data_loop : property_base
 {
     bindable<int> limit;
     field_ref<int> index; //int indexes are easier than size_t
+    direct_val<bool> clip = false; //iterate visible items only
 
     bool empty() const {
         return limit.empty();
@@ -1061,6 +1128,17 @@ struct data_loop : property_base
     bool set_from_arg(std::string_view code) {
         if (code.compare(0, 4, "for("))
             return false;
+        const std::string_view CLIP = "ImRad::ClipRange(";
+        auto j = code.find(CLIP);
+        if (j != std::string::npos && code.find(';') == std::string::npos) {
+            if (code.size() < j + CLIP.size() + 2 || code.compare(code.size() - 2, 2, "))"))
+                return false;
+            clip = true;
+            *index.access() = "";
+            limit.set_from_arg(code.substr(j + CLIP.size(), code.size() - 2 - j - CLIP.size()));
+            return true;
+        }
+        clip = false;
         bool local = !code.compare(4, 3, "int") || !code.compare(4, 6, "size_t");
         auto i = code.find(";");
         if (i == std::string::npos)
@@ -1086,6 +1164,10 @@ struct data_loop : property_base
             return "";
         std::ostringstream os;
         std::string name = index_name_or(std::string(forVarName));
+        if (clip && index.empty()) {
+            os << "for (int " << name << " : ImRad::ClipRange(" << limit.to_arg() << "))";
+            return os.str();
+        }
         os << "for (";
         if (index.empty())
             os << "int ";
@@ -1104,6 +1186,11 @@ struct data_loop : property_base
         limit.rename_variable(oldn, newn);
         index.rename_variable(oldn, newn);
     }
+    uint64_t var_hash() const {
+        uint64_t hash = limit.var_hash();
+        uint64_t hash2 = index.var_hash();
+        return hash2 ? (hash * 0x100000001b3ull) ^ hash2 : hash;
+    }
     const char* c_str() const { return limit.c_str(); }
     std::string* access() { return limit.access(); }
 };
@@ -65,18 +65,22 @@ std::string typeid_name()
         return "std::vector<std::string>";
     else
     {
-        std::string str = typeid(T).name();
+        //demangle once per type, property UIs query it every frame
+        static const std::string name = [] {
+            std::string str = typeid(T).name();
 #ifdef WIN32
-        auto i = str.find(' ');
-        if (i != std::string::npos)
-            str.erase(0, i + 1); //erase leading struct etc.
+            auto i = str.find(' ');
+            if (i != std::string::npos)
+                str.erase(0, i + 1); //erase leading struct etc.
 #else
-        int status;
-        char* ptr = abi::__cxa_demangle(str.c_str(), nullptr, nullptr, &status);
-        str = ptr;
-        free(ptr);
+            int status;
+            char* ptr = abi::__cxa_demangle(str.c_str(), nullptr, nullptr, &status);
+            str = ptr;
+            free(ptr);
 #endif
-        return str;
+            return str;
+        }();
+        return name;
     }
 }
 
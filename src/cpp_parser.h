@@ -560,7 +560,7 @@ namespace cpp
     inline bool is_std_container(std::string_view s, std::string& elemType)
     {
         static const std::string_view names[]{
-            "std::vector", "std::array", "std::span",
+            "std::vector", "std::array", "std::span", "ImRad::DataView",
         };
 
         if (!s.compare(0, 6, "const "))
@@ -630,6 +630,20 @@ namespace cpp
         return true;
     }
 
+    //ImRad::Latest<T> exposes its per-frame snapshot through Get()
+    inline bool is_latest(std::string_view s, std::string& valueType)
+    {
+        if (!s.compare(0, 6, "const "))
+            s.remove_prefix(6);
+        if (s.size() && s.back() == '&')
+            s.remove_suffix(1);
+        if (s.empty() || s.compare(0, 14, "ImRad::Latest<") || s.back() != '>')
+            return false;
+
+        valueType = s.substr(14, s.size() - 15);
+        return true;
+    }
+
     inline bool is_std_container(std::string_view s)
     {
         std::string elemType;
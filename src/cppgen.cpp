@@ -2,7 +2,9 @@
 #include "cpp_parser.h"
 #include "stx.h"
 #include "utils.h"
+#include "node_container.h"
 #include <fstream>
+#include <iterator>
 #include <cctype>
 #include <set>
 
@@ -17,6 +19,8 @@ const std::string_view CppGen::FOR_VAR_NAME = "i";
 const std::string_view CppGen::CUR_ITEM_VAR_NAME = "_item";
 const std::string_view CppGen::HBOX_NAME = "hb";
 const std::string_view CppGen::VBOX_NAME = "vb";
+const std::string_view CppGen::CULL_NAME = "cull";
+bool CppGen::designCache = false;
 
 bool IsFunType(std::string_view type, std::string& ret, std::string& arg)
 {
@@ -151,61 +155,365 @@ bool CppGen::ExportUpdate(
     auto uit = params.find("unit");
     if (uit != params.end())
         ctx.unit = uit->second;
-    std::ostringstream code;
+    stx::string_ostream code;
     node->Export(code, ctx);
     for (const std::string& e : ctx.errors)
         err += e + "\n";
 
     //export .h
+    //output is generated in memory first and written atomically so that a failed
+    //or concurrent save never leaves truncated sources behind
     m_error = "";
     auto hpath = u8path(fname).replace_extension(".h");
-    if (!fs::exists(hpath) || fs::is_empty(hpath))
-    {
-        std::ofstream fout(hpath);
-        if (!fout) {
-            err = "can't write to '" + hpath.string() + "'";
-            return false;
-        }
-        CreateH(fout);
+    std::string prev;
+    bool exists = ReadPrevFile(hpath, prev);
+    if (!exists) {
+        stx::string_ostream tmp;
+        CreateH(tmp);
+        prev = std::move(tmp.str());
     }
-    std::ifstream fin(hpath);
-    std::string line;
-    std::stringstream fprev;
-    while (std::getline(fin, line))
-        fprev << line << "\n";
-    fin.close();
-    fprev.seekg(0);
-    std::ofstream fout(hpath, std::ios::trunc);
-    auto origNames = ExportH(fout, fprev, m_hname, node);
+    stx::string_ostream fout;
+    auto origNames = ExportH(fout, prev, m_hname, node);
+    if (!WriteChanged(hpath, fout.str(), exists ? &prev : nullptr, m_fileHash[0], err))
+        return false;
     m_hname = u8string(hpath.filename());
-    fout.close();
     err += m_error;
 
     //export .cpp
     m_error = "";
     auto fpath = u8path(fname).replace_extension(".cpp");
-    if (!fs::exists(fpath) || fs::is_empty(fpath))
+    prev.clear();
+    exists = ReadPrevFile(fpath, prev);
+    if (!exists) {
+        stx::string_ostream tmp;
+        CreateCpp(tmp);
+        prev = std::move(tmp.str());
+    }
+    fout.reset();
+    ExportCpp(fout, prev, origNames, params, node, code.str());
+    if (!WriteChanged(fpath, fout.str(), exists ? &prev : nullptr, m_fileHash[1], err))
+        return false;
+    err += m_error;
+
+    if (designCache && err == "")
+        WriteCache(fname, node, params, code.str());
+    return true;
+}
+
+//skips writing when content didn't change so file time stays untouched
+//and dependent translation units don't get rebuilt
+//prev is the current file content or nullptr when the file doesn't exist
+bool CppGen::WriteChanged(const fs::path& path, const std::string& data, const std::string* prev, uint64_t& hash, std::string& err)
+{
+    if (!prev || data != *prev) {
+        if (!WriteFileAtomic(path, data, err))
+            return false;
+    }
+    hash = HashContent(data);
+    return true;
+}
+
+//returns false when there is no previous content to follow
+//also refreshes cached hash of the file content
+bool CppGen::ReadPrevFile(const fs::path& path, std::string& content)
+{
+    int i = u8string(path.extension()).compare(0, 2, ".h") ? 1 : 0;
+    m_fileHash[i] = 0;
+    std::error_code ec;
+    auto size = fs::file_size(path, ec);
+    if (ec || !size)
+        return false;
+    std::ifstream fin(path);
+    if (!fin)
+        return false;
+    content.reserve(content.size() + size + 1);
+    std::string line;
+    while (std::getline(fin, line)) {
+        content += line;
+        content += '\n';
+    }
+    m_fileHash[i] = HashContent(content);
+    return true;
+}
+
+//design cache stores parsed node tree and fields in a binary form next to
+//the sources so reopening unchanged files skips the C++ parser
+//it is keyed by content hashes of both generated files
+const std::string_view CACHE_MAGIC = "ImRADc1";
+
+void WriteCacheNum(std::ostream& os, uint64_t v)
+{
+    os.write((const char*)&v, sizeof(v));
+}
+
+void WriteCacheStr(std::ostream& os, std::string_view s)
+{
+    WriteCacheNum(os, s.size());
+    os.write(s.data(), s.size());
+}
+
+bool ReadCacheNum(std::istream& is, uint64_t& v)
+{
+    return (bool)is.read((char*)&v, sizeof(v));
+}
+
+bool ReadCacheStr(std::istream& is, std::string& s)
+{
+    uint64_t n;
+    if (!ReadCacheNum(is, n) || n > (1u << 30))
+        return false;
+    s.resize(n);
+    return (bool)is.read(s.data(), n);
+}
+
+//data_loop::to_arg generates whole for statement which doesn't parse back
+void WriteCacheProps(std::ostream& os, const std::vector<UINode::Prop>& props)
+{
+    uint64_t n = stx::count_if(props, [](const auto& p) { return p.property; });
+    WriteCacheNum(os, n);
+    for (const auto& p : props)
+    {
+        if (!p.property)
+            continue;
+        WriteCacheStr(os, p.name);
+        if (auto* dl = dynamic_cast<data_loop*>(p.property))
+            WriteCacheStr(os, dl->index.to_arg() + ";" + dl->limit.to_arg());
+        else
+            WriteCacheStr(os, p.property->to_arg());
+    }
+}
+
+//props are looked up by name as Behavior can change the property list
+template <class F>
+bool ReadCacheProps(std::istream& is, F&& getProps)
+{
+    uint64_t n;
+    if (!ReadCacheNum(is, n))
+        return false;
+    auto props = getProps();
+    std::string name, val;
+    for (uint64_t i = 0; i < n; ++i)
     {
-        std::ofstream fout(fpath);
-        if (!fout) {
-            err = "can't write to '" + hpath.string() + "'";
+        if (!ReadCacheStr(is, name) || !ReadCacheStr(is, val))
             return false;
+        auto it = stx::find_if(props, [&](const auto& p) { return p.name == name; });
+        if (it == props.end()) {
+            props = getProps();
+            it = stx::find_if(props, [&](const auto& p) { return p.name == name; });
+            if (it == props.end())
+                return false;
         }
-        CreateCpp(fout);
+        if (auto* dl = dynamic_cast<data_loop*>(it->property)) {
+            size_t j = val.find(';');
+            dl->index.set_from_arg(val.substr(0, j));
+            dl->limit.set_from_arg(val.substr(j + 1));
+        }
+        else if (!it->property->set_from_arg(val))
+            return false;
     }
-    fin.open(fpath);
-    fprev.str("");
-    fprev.clear();
-    while (std::getline(fin, line))
-        fprev << line << "\n";
-    fin.close();
-    fprev.seekg(0);
-    fout.open(fpath, std::ios::trunc);
-    ExportCpp(fout, fprev, origNames, params, node, code.str());
-    err += m_error;
     return true;
 }
 
+void WriteCacheNode(std::ostream& os, UINode* node)
+{
+    WriteCacheStr(os, node->GetTypeName());
+    WriteCacheProps(os, node->Properties());
+    WriteCacheProps(os, node->Events());
+    if (auto* tw = dynamic_cast<TopWindow*>(node)) {
+        WriteCacheStr(os, tw->userCodeBefore);
+        WriteCacheStr(os, tw->userCodeAfter);
+        WriteCacheStr(os, tw->userCodeMid);
+    }
+    else if (auto* w = dynamic_cast<Widget*>(node)) {
+        WriteCacheStr(os, w->userCodeBefore);
+        WriteCacheStr(os, w->userCodeAfter);
+    }
+    if (auto* table = dynamic_cast<Table*>(node)) {
+        WriteCacheNum(os, table->columnData.size());
+        for (auto& cd : table->columnData)
+            WriteCacheProps(os, cd.Properties());
+    }
+    WriteCacheNum(os, node->children.size());
+    for (const auto& child : node->children)
+        WriteCacheNode(os, child.get());
+}
+
+bool ReadCacheNode(std::istream& is, UINode* node, UIContext& ctx)
+{
+    if (!ReadCacheProps(is, [node] { return node->Properties(); }) ||
+        !ReadCacheProps(is, [node] { return node->Events(); }))
+        return false;
+    if (auto* tw = dynamic_cast<TopWindow*>(node)) {
+        if (!ReadCacheStr(is, tw->userCodeBefore) ||
+            !ReadCacheStr(is, tw->userCodeAfter) ||
+            !ReadCacheStr(is, tw->userCodeMid))
+            return false;
+    }
+    else if (auto* w = dynamic_cast<Widget*>(node)) {
+        if (!ReadCacheStr(is, w->userCodeBefore) ||
+            !ReadCacheStr(is, w->userCodeAfter))
+            return false;
+    }
+    uint64_t n;
+    if (auto* table = dynamic_cast<Table*>(node)) {
+        if (!ReadCacheNum(is, n))
+            return false;
+        table->columnData.resize(n);
+        for (auto& cd : table->columnData)
+            if (!ReadCacheProps(is, [&cd] { return cd.Properties(); }))
+                return false;
+    }
+    if (!ReadCacheNum(is, n))
+        return false;
+    std::string tname;
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        if (!ReadCacheStr(is, tname))
+            return false;
+        auto child = Widget::Create(tname, ctx);
+        if (!child)
+            return false;
+        auto* ch = child.get();
+        node->children.push_back(std::move(child));
+        ctx.parents.push_back(ch);
+        bool ok = ReadCacheNode(is, ch, ctx);
+        ctx.parents.pop_back();
+        if (!ok)
+            return false;
+    }
+    //textures are only loaded for the design shown to the user
+    if (auto* image = dynamic_cast<Image*>(node); image && ctx.importState && ctx.loadTextures)
+        image->RefreshTexture(ctx);
+    return true;
+}
+
+fs::path CppGen::CachePath(const std::string& fname) const
+{
+    fs::path p = u8path(fname);
+    return p.parent_path() / ".imrad-cache" / fs::path(p.filename()).replace_extension(".bin");
+}
+
+//exports node using a scratch copy of fields so this generator stays untouched
+std::string CppGen::ExportCode(TopWindow* node, const std::map<std::string, std::string>& params) const
+{
+    CppGen gen = *this;
+    UIContext ctx;
+    ctx.codeGen = &gen;
+    ctx.ind = INDENT;
+    auto uit = params.find("unit");
+    if (uit != params.end())
+        ctx.unit = uit->second;
+    stx::string_ostream code;
+    node->Export(code, ctx);
+    return std::move(code.str());
+}
+
+//cache is only written when the restored tree generates identical code
+//a lossy cache would drop widget state on the next open and save
+void CppGen::WriteCache(const std::string& fname, TopWindow* node, const std::map<std::string, std::string>& params, const std::string& code)
+{
+    if (!m_fileHash[0] || !m_fileHash[1])
+        return;
+    stx::string_ostream os;
+    os.write(CACHE_MAGIC.data(), CACHE_MAGIC.size());
+    WriteCacheStr(os, VER_STR);
+    WriteCacheNum(os, m_fileHash[0]);
+    WriteCacheNum(os, m_fileHash[1]);
+    WriteCacheStr(os, m_name);
+    WriteCacheStr(os, m_vname);
+    WriteCacheNum(os, params.size());
+    for (const auto& kv : params) {
+        WriteCacheStr(os, kv.first);
+        WriteCacheStr(os, kv.second);
+    }
+    WriteCacheNum(os, m_fields.size());
+    for (const auto& scope : m_fields) {
+        WriteCacheStr(os, scope.first);
+        WriteCacheNum(os, scope.second.size());
+        for (const auto& var : scope.second) {
+            WriteCacheStr(os, var.name);
+            WriteCacheStr(os, var.type);
+            WriteCacheStr(os, var.init);
+            WriteCacheNum(os, var.flags);
+        }
+    }
+    WriteCacheNode(os, node);
+
+    auto path = CachePath(fname);
+    std::error_code ec;
+    CppGen gen = *this;
+    std::map<std::string, std::string> params2;
+    auto node2 = gen.ReadCache(os.str(), params2, false);
+    if (!node2 || params2 != params ||
+        gen.ExportCode(node2.get(), params) != (code.empty() ? ExportCode(node, params) : code))
+    {
+        fs::remove(path, ec);
+        return;
+    }
+
+    fs::create_directories(path.parent_path(), ec);
+    std::string err;
+    WriteFileAtomic(path, os.str(), err, true);
+}
+
+//restores state from cache data when it matches current file hashes
+std::unique_ptr<TopWindow>
+CppGen::ReadCache(std::string_view data, std::map<std::string, std::string>& params, bool live)
+{
+    stx::ispanstream is(data);
+    std::string magic(CACHE_MAGIC.size(), ' '), str, str2;
+    uint64_t hash[2], n, m, flags;
+    if (!is.read(magic.data(), magic.size()) || magic != CACHE_MAGIC)
+        return {};
+    if (!ReadCacheStr(is, str) || str != VER_STR)
+        return {};
+    if (!ReadCacheNum(is, hash[0]) || !ReadCacheNum(is, hash[1]) ||
+        hash[0] != m_fileHash[0] || hash[1] != m_fileHash[1])
+        return {};
+    if (!ReadCacheStr(is, m_name) || !ReadCacheStr(is, m_vname) || !ReadCacheNum(is, n))
+        return {};
+    for (uint64_t i = 0; i < n; ++i) {
+        if (!ReadCacheStr(is, str) || !ReadCacheStr(is, str2))
+            return {};
+        params[str] = str2;
+    }
+    m_fields.clear();
+    m_varExprs.clear();
+    if (!ReadCacheNum(is, n))
+        return {};
+    for (uint64_t i = 0; i < n; ++i) {
+        if (!ReadCacheStr(is, str) || !ReadCacheNum(is, m))
+            return {};
+        auto& vars = m_fields[str];
+        for (uint64_t j = 0; j < m; ++j) {
+            Var var("", "", "", 0);
+            if (!ReadCacheStr(is, var.name) || !ReadCacheStr(is, var.type) ||
+                !ReadCacheStr(is, var.init) || !ReadCacheNum(is, flags))
+                return {};
+            var.flags = (int)flags;
+            vars.push_back(std::move(var));
+        }
+    }
+
+    //cache is only accepted when written by this version
+    ctx_importVersion = ParseVersion(VER_STR);
+    UIContext ctx;
+    ctx.codeGen = this;
+    ctx.workingDir = ctx_workingDir;
+    ctx.importVersion = ctx_importVersion;
+    ctx.createVars = false;
+    ctx.importState = live;
+    ctx.loadTextures = ctx_loadTextures;
+    auto node = std::make_unique<TopWindow>(ctx);
+    ctx.root = node.get();
+    ctx.parents = { node.get() };
+    if (!ReadCacheStr(is, str) || !ReadCacheNode(is, node.get(), ctx))
+        return {};
+    for (const std::string& e : ctx.errors)
+        m_error += e + "\n";
+    return node;
+}
+
 void CppGen::CreateH(std::ostream& out)
 {
     out << "// " << GENERATED_WITH << VER_STR << "\n"
@@ -238,11 +546,44 @@ void CppGen::CreateCpp(std::ostream& out)
     out << m_name << " " << m_vname << ";\n\n";
 }
 
+//threaded parts of the runtime are opt-in so that windows which don't
+//use them don't pull <thread>, <mutex> etc.
+std::vector<std::string>
+CppGen::GetRuntimeHeaders(TopWindow* node)
+{
+    bool feed = false, data = false, async = false;
+    for (const auto& scope : m_fields)
+        for (const auto& var : scope.second)
+        {
+            if (!var.type.compare(0, 16, "ImRad::LogBuffer") ||
+                !var.type.compare(0, 15, "ImRad::Channel<") ||
+                !var.type.compare(0, 14, "ImRad::Latest<"))
+                feed = true;
+            else if (!var.type.compare(0, 16, "ImRad::DataView<") ||
+                var.type == "ImRad::RowOrder")
+                data = true;
+            else if (!var.type.compare(0, 11, "ImRad::Task"))
+                async = true;
+        }
+    for (UINode* ch : node->GetAllChildren())
+        if (dynamic_cast<LogView*>(ch) || dynamic_cast<Plot*>(ch))
+            feed = true;
+
+    std::vector<std::string> hnames;
+    if (feed)
+        hnames.push_back("imrad_feed.h");
+    if (data)
+        hnames.push_back("imrad_data.h");
+    if (async)
+        hnames.push_back("imrad_async.h");
+    return hnames;
+}
+
 //follows fprev and overwrites generated members/functions only
 std::array<std::string, 3>
 CppGen::ExportH(
     std::ostream& fout,
-    std::istream& fprev,
+    std::string_view prev,
     const std::string& origHName,
     TopWindow* node
 )
@@ -252,25 +593,23 @@ CppGen::ExportH(
     bool preamble = true;
     int skip_to_level = -1;
     std::vector<std::string> line;
-    std::streampos fpos = 0;
+    std::streamoff fpos = 0;
     std::string ignore_section = "";
     std::string className;
     std::string origName, origVName;
-    std::stringstream out;
+    stx::string_ostream out;
     bool hasLayout = GetLayoutVars().size();
 
+    stx::ispanstream fprev(prev);
+
     //xpos == 0 => copy until current position
     //xpos > 0 => copy until xpos
     //xpos < 0 => copy except last xpos characters
+    //copies spans of prev directly, token_iterator position is not disturbed
     auto copy_content = [&](int xpos = 0) {
         int pos = (int)fprev.tellg();
         int ignore_last = xpos < 0 ? -xpos : xpos > 0 ? pos - xpos : 0;
-        std::string buf;
-        fprev.seekg(fpos);
-        buf.resize(pos - fpos - ignore_last);
-        fprev.read(buf.data(), buf.size());
-        out.write(buf.data(), buf.size());
-        fprev.ignore(ignore_last);
+        out.write(prev.data() + fpos, pos - fpos - ignore_last);
         fpos = pos;
     };
 
@@ -528,6 +867,12 @@ CppGen::ExportH(
         }
         else if (!tok.compare(0, 1, "#")) {
             preamble = false;
+            if (tok == "#include \"imrad.h\"") {
+                copy_content();
+                for (const std::string& hname : GetRuntimeHeaders(node))
+                    if (prev.find("#include \"" + hname + "\"") == std::string::npos)
+                        out << "\n#include \"" << hname << "\"";
+            }
         }
         else if (tok == ";") {
             if (line.size() == 3 && line[0] == "extern" && line[1] == origName) {
@@ -547,7 +892,7 @@ CppGen::ExportH(
     copy_content();
 
     //replace class name
-    std::string code = out.str();
+    std::string& code = out.str();
     cpp::replace_id(code, origName, m_name);
     cpp::replace_id(code, origVName, m_vname);
 
@@ -560,7 +905,7 @@ CppGen::ExportH(
 void
 CppGen::ExportCpp(
     std::ostream& fout,
-    std::istream& fprev,
+    std::string_view prev,
     const std::array<std::string, 3>& origNames, //name, vname, old header name
     const std::map<std::string, std::string>& params,
     TopWindow* node,
@@ -572,22 +917,20 @@ CppGen::ExportCpp(
     int comment_to_level = -1;
     bool preamble = true;
     std::vector<std::string> line;
-    std::streampos fpos = 0;
+    std::streamoff fpos = 0;
     std::set<std::string> funs;
     auto animPos = node->animate ? (TopWindow::Placement)node->placement : TopWindow::None;
 
+    stx::ispanstream fprev(prev);
+
     //xpos == 0 => copy until current position
     //xpos > 0 => copy until xpos
     //xpos < 0 => copy except last xpos characters
+    //copies spans of prev directly, token_iterator position is not disturbed
     auto copy_content = [&](int xpos = 0) {
         int pos = (int)fprev.tellg();
         int ignore_last = xpos < 0 ? -xpos : xpos > 0 ? pos - xpos : 0;
-        std::string buf;
-        fprev.seekg(fpos);
-        buf.resize(pos - fpos - ignore_last);
-        fprev.read(buf.data(), buf.size());
-        fout.write(buf.data(), buf.size());
-        fprev.ignore(ignore_last);
+        fout.write(prev.data() + fpos, pos - fpos - ignore_last);
         fpos = pos;
     };
 
@@ -596,12 +939,16 @@ CppGen::ExportCpp(
         std::string tok = *iter;
         if (!level) //global scope
         {
-            if (origNames[2] != "" &&
-                !tok.compare(0, 10, "#include \"") &&
-                !tok.compare(10, origNames[2].size(), origNames[2]))
+            if (!tok.compare(0, 10, "#include \"") &&
+                ((origNames[2] != "" && !tok.compare(10, origNames[2].size(), origNames[2])) ||
+                tok == "#include \"" + m_hname + "\""))
             {
                 copy_content(-(int)tok.size());
                 fout << "#include \"" << m_hname << "\"";
+                //imrad.h only declares GLFWwindow, MainWindow code calls glfw directly
+                if (node->kind == TopWindow::MainWindow &&
+                    prev.find("#include <GLFW/glfw3.h>") == std::string::npos)
+                    fout << "\n#include <GLFW/glfw3.h>";
             }
             else if (!tok.compare(0, 2, "//")) {
                 if (preamble && tok.find(GENERATED_WITH) != std::string::npos) {
@@ -727,7 +1074,13 @@ CppGen::ExportCpp(
         if (arg != "")
             fout << arg << " args";
         fout << ")\n{\n";
-        if (ret != "void")
+        if (ret == "ImRad::Task")
+        {
+            //async handler, code after co_await continues on the UI thread
+            fout << INDENT << "co_await ImRad::RunAsync([] {\n";
+            fout << INDENT << "});\n";
+        }
+        else if (ret != "void")
         {
             fout << INDENT << "return ";
             std::string init = DefaultInitFor(ret);
@@ -744,7 +1097,8 @@ std::vector<std::string> CppGen::GetLayoutVars()
     const auto& allVars = m_fields[""];
     for (const Var& var : allVars)
     {
-        if (var.type == "ImRad::HBox" || var.type == "ImRad::VBox")
+        if (var.type == "ImRad::HBox" || var.type == "ImRad::VBox" ||
+            var.type == "ImRad::CullBlocks")
             vars.push_back(var.name);
     }
     return vars;
@@ -889,31 +1243,57 @@ std::unique_ptr<TopWindow>
 CppGen::Import(
     const std::string& path,
     std::map<std::string, std::string>& params,
-    std::string& err
+    std::string& err,
+    bool loadTextures
 )
 {
     m_fields.clear();
     m_fields[""];
+    m_varExprs.clear();
     m_name = m_vname = "";
     m_error = "";
     ctx_workingDir = u8string(u8path(path).parent_path());
     ctx_importVersion = 0;
+    ctx_loadTextures = loadTextures;
     std::unique_ptr<TopWindow> node;
 
-    auto fpath = u8path(path).replace_extension("h");
-    m_hname = u8string(fpath.filename());
-    std::ifstream fin(fpath);
-    if (!fin)
-        m_error += "Can't read " + u8string(fpath) + "\n";
-    else
+    auto hpath = u8path(path).replace_extension("h");
+    auto fpath = u8path(path).replace_extension("cpp");
+    m_hname = u8string(hpath.filename());
+    std::string hcontent, content;
+    bool hok = ReadPrevFile(hpath, hcontent);
+    bool cppok = ReadPrevFile(fpath, content);
+
+    if (designCache && hok && cppok)
+    {
+        std::ifstream fin(CachePath(path), std::ios::binary);
+        std::string data{ std::istreambuf_iterator<char>(fin), std::istreambuf_iterator<char>() };
+        std::map<std::string, std::string> cparams;
+        if (data.size() && (node = ReadCache(data, cparams, true))) {
+            for (const auto& kv : cparams)
+                params[kv.first] = kv.second;
+            err = m_error;
+            return node;
+        }
+        m_fields.clear();
+        m_fields[""];
+        m_varExprs.clear();
+        m_name = m_vname = "";
+        m_error = "";
+        ctx_importVersion = 0;
+    }
+
+    if (!hok)
+        m_error += "Can't read " + u8string(hpath) + "\n";
+    else {
+        stx::ispanstream fin(hcontent);
         node = ImportCode(fin, m_hname, params);
-    fin.close();
+    }
 
-    fpath = u8path(path).replace_extension("cpp");
-    fin.open(fpath);
-    if (!fin)
+    if (!cppok)
         m_error += "Can't read \"" + u8string(fpath) + "\"\n";
     else {
+        stx::ispanstream fin(content);
         auto node2 = ImportCode(fin, u8string(fpath.filename()), params);
         if (!node)
             node = std::move(node2);
@@ -929,6 +1309,8 @@ CppGen::Import(
         m_error += "No fields section found!\n";
     if (!found_events)
         m_error += "No events section found!\n";*/
+    if (designCache && node && m_error == "")
+        WriteCache(path, node.get(), params, "");
     err = m_error;
     return node;
 }
@@ -1044,11 +1426,18 @@ bool CppGen::ParseFieldDecl(const std::string& sname, const std::vector<std::str
         return false;
 
     //parse event declaration
-    if (line.size() >= 4 &&
-        cpp::is_id(line[0]) &&
-        cpp::is_id(line[1]) && line[2] == "(" && line.back() == ")")
+    //return type can be qualified as in ImRad::Task
+    size_t lpar = stx::find(line, "(") - line.begin();
+    std::string retType;
+    bool isEvent = lpar >= 2 && lpar < line.size() && line.back() == ")" &&
+        cpp::is_id(line[lpar - 1]) && lpar % 2 == 0;
+    for (size_t i = 0; isEvent && i + 1 < lpar; ++i) {
+        isEvent = i % 2 ? line[i] == "::" : cpp::is_id(line[i]);
+        retType += line[i];
+    }
+    if (isEvent)
     {
-        std::string name = line[1];
+        std::string name = line[lpar - 1];
         //currently we allow generated Close/Popup in event handler list
         if (stx::count(SPEC_FUN, name) && name != "Close" && name != "ClosePopup")
             return false;
@@ -1060,7 +1449,7 @@ bool CppGen::ParseFieldDecl(const std::string& sname, const std::vector<std::str
         bool typeValid = false;
         bool gotId = false;
         int level = 0;
-        for (size_t i = 3; i < line.size() - 1; ++i)
+        for (size_t i = lpar + 1; i < line.size() - 1; ++i)
         {
             if (line[i] == "," && !level) {
                 ignore = false;
@@ -1091,7 +1480,7 @@ bool CppGen::ParseFieldDecl(const std::string& sname, const std::vector<std::str
                 (cpp::is_id(line[i]) ||
                 line[i] == ">" || line[i] == "&" || line[i] == "*");
         }
-        std::string type = line[0] + "(" + argTypes + ")";
+        std::string type = retType + "(" + argTypes + ")";
 
         CreateNamedVar(name, type, "", flags, sname);
     }
@@ -1176,11 +1565,12 @@ bool CppGen::ParseFieldDecl(const std::string& sname, const std::vector<std::str
 
 std::string CppGen::IsMemFun(const std::vector<std::string>& line)
 {
-    if (line.size() >= 6 &&
-        /*line[0] == "void" &&*/ line[1] == m_name && line[2] == "::" &&
-        line[4] == "(" && line.back() == ")")
+    //return type can be qualified as in ImRad::Task
+    size_t lpar = stx::find(line, "(") - line.begin();
+    if (lpar >= 4 && lpar < line.size() &&
+        line[lpar - 3] == m_name && line[lpar - 2] == "::" && line.back() == ")")
     {
-        return line[3];
+        return line[lpar - 1];
     }
     return "";
 }
@@ -1225,6 +1615,7 @@ CppGen::ParseDrawFun(const std::vector<std::string>& line, cpp::token_iterator&
     ctx.codeGen = this;
     ctx.workingDir = ctx_workingDir;
     ctx.importVersion = ctx_importVersion;
+    ctx.loadTextures = ctx_loadTextures;
     auto node = std::make_unique<TopWindow>(ctx);
     node->Import(sit, ctx);
     iter = sit.base();
@@ -1279,6 +1670,7 @@ std::string CppGen::CreateVar(const std::string& type, const std::string& init,
     }
     std::string name = "value" + std::to_string(++max);
     vit->second.push_back(Var(name, CppType(type), init, flags));
+    m_varExprs.clear();
     return name;
 }
 
@@ -1292,6 +1684,7 @@ bool CppGen::CreateNamedVar(const std::string& name, const std::string& type, co
     if (FindVar(name, scope))
         return false;
     vit->second.push_back(Var(name, CppType(type), init, flags));
+    m_varExprs.clear();
     return true;
 }
 
@@ -1303,6 +1696,7 @@ bool CppGen::RenameVar(const std::string& oldn, const std::string& newn, const s
     if (!var)
         return false;
     var->name = newn;
+    m_varExprs.clear();
     return true;
 }
 
@@ -1315,6 +1709,7 @@ bool CppGen::RemoveVar(const std::string& name, const std::string& scope)
     if (it == vit->second.end())
         return false;
     vit->second.erase(it);
+    m_varExprs.clear();
     return true;
 }
 
@@ -1323,6 +1718,7 @@ void CppGen::RemovePrefixedVars(const std::string& prefix, const std::string& sc
     auto vit = m_fields.find(scope);
     if (vit == m_fields.end())
         return;
+    size_t n = vit->second.size();
     stx::erase_if(vit->second, [&](const auto& var)
     {
         if (var.flags & Var::UserCode)
@@ -1334,6 +1730,8 @@ void CppGen::RemovePrefixedVars(const std::string& prefix, const std::string& sc
                 return false;
         return true;
     });
+    if (vit->second.size() != n)
+        m_varExprs.clear();
 }
 
 bool CppGen::ChangeVar(const std::string& name, const std::string& type, const std::string& init, int flags, const std::string& scope)
@@ -1342,6 +1740,7 @@ bool CppGen::ChangeVar(const std::string& name, const std::string& type, const s
     if (!var)
         return false;
     var->type = CppType(type);
+    m_varExprs.clear();
     var->init = init;
     if (flags != -1)
         var->flags = flags;
@@ -1384,6 +1783,7 @@ bool CppGen::RenameStruct(const std::string& oldn, const std::string& newn)
         return false;
     m_fields[newn] = std::move(it->second);
     m_fields.erase(oldn);
+    m_varExprs.clear();
     return true;
 }
 
@@ -1518,6 +1918,7 @@ bool CppGen::CreateVarExpr(std::string& name, const std::string& type_, const st
                 if (FindVar(id, scope))
                     return false;
                 m_fields[id];
+                m_varExprs.clear();
             }
             else if (!array) {
                 bool fun = IsFunType(stype);
@@ -1534,8 +1935,10 @@ bool CppGen::CreateVarExpr(std::string& name, const std::string& type_, const st
             else {
                 if (!CreateNamedVar(id, "std::vector<" + stype + ">", init, flags, scope))
                     return false;
-                if (!leaf)
+                if (!leaf) {
                     m_fields[stype];
+                    m_varExprs.clear();
+                }
             }
             scope = stype;
         }
@@ -1584,6 +1987,15 @@ CppGen::MatchType(const std::string& name, std::string_view type, std::string_vi
             ret.insert(ret.end(), more.begin(), more.end());
         }
     }
+    else if (cpp::is_latest(type, valueType))
+    {
+        //snapshot is read only
+        if (reference)
+            return ret;
+        std::string pre = name[0]=='*' ? name.substr(1) + "->" : name + ".";
+        auto more = MatchType(pre + "Get()", valueType, match, reference, curArray);
+        ret.insert(ret.end(), more.begin(), more.end());
+    }
     else if (cpp::is_std_pair(type, firstType, secondType))
     {
         std::string pre = name[0]=='*' ? name.substr(1) + "->" : name + ".";
@@ -1614,18 +2026,38 @@ CppGen::MatchType(const std::string& name, std::string_view type, std::string_vi
 //type==void() accepts all functions of this type
 //reference only accepts lvalues
 //curArray accepts its array elements as well
-std::vector<std::pair<std::string, std::string>> //(name, type)
+//results are cached until next change of fields, returned list is immutable
+//and stays valid even when fields change while it's being iterated
+std::shared_ptr<const CppGen::VarExprs>
 CppGen::GetVarExprs(const std::string& type_, bool reference, const std::string& curArray)
 {
     assert(type_.find("const ") == std::string::npos && type_.find("&") == std::string::npos);
     std::string type = CppType(type_);
-    std::vector<std::pair<std::string, std::string>> ret;
+    auto key = std::make_tuple(type, reference, curArray);
+    auto it = m_varExprs.find(key);
+    if (it != m_varExprs.end())
+        return it->second;
+
+    VarExprs ret;
     for (const auto& f : m_fields[""])
     {
         auto match = MatchType(f.name, f.type, type, reference, curArray);
-        ret.insert(ret.end(), match.begin(), match.end());
+        ret.insert(ret.end(), std::make_move_iterator(match.begin()), std::make_move_iterator(match.end()));
     }
     stx::sort(ret);
-    return ret;
+    return m_varExprs[key] = std::make_shared<const VarExprs>(std::move(ret));
 }
 
+//GetVarExprs restricted to names starting with prefix
+CppGen::VarExprs
+CppGen::FindVarExprs(std::string_view prefix, const std::string& type, bool reference, const std::string& curArray)
+{
+    auto vars = GetVarExprs(type, reference, curArray);
+    auto it = std::lower_bound(vars->begin(), vars->end(), prefix, [](const auto& var, std::string_view p) {
+        return var.first < p;
+        });
+    VarExprs ret;
+    for (; it != vars->end() && !it->first.compare(0, prefix.size(), prefix); ++it)
+        ret.push_back(*it);
+    return ret;
+}
@@ -2,6 +2,10 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <memory>
+#include <string_view>
+#include <tuple>
+#include <sstream>
 #include "node_window.h"
 
 //------------------------------------------------------
@@ -13,10 +17,14 @@ public:
     static const std::string_view CUR_ITEM_VAR_NAME;
     static const std::string_view HBOX_NAME;
     static const std::string_view VBOX_NAME;
+    static const std::string_view CULL_NAME;
+    //reuse .imrad-cache binary design data when generated files didn't change
+    static bool designCache;
 
     CppGen();
     bool ExportUpdate(const std::string& fname, TopWindow* node, const std::map<std::string, std::string>& params, std::string& err);
-    auto Import(const std::string& path, std::map<std::string, std::string>& params, std::string& err) -> std::unique_ptr<TopWindow>;
+    //loadTextures=false allows to import from a worker thread
+    auto Import(const std::string& path, std::map<std::string, std::string>& params, std::string& err, bool loadTextures = true) -> std::unique_ptr<TopWindow>;
     auto AltFName(const std::string& path) const -> std::string;
     int ReadGenVersion(const std::string& fname) const;
 
@@ -51,17 +59,26 @@ public:
     enum VarExprResult { SyntaxError, ConflictError, Existing, New, New_ImplicitStruct };
     VarExprResult CheckVarExpr(const std::string& name, const std::string& type, const std::string& scope = "");
     bool CreateVarExpr(std::string& name, const std::string& type, const std::string& init, int flags, const std::string& scope = "");
-    auto GetVarExprs(const std::string& type, bool reference, const std::string& curArray = "") ->std::vector<std::pair<std::string, std::string>>;
+    using VarExprs = std::vector<std::pair<std::string, std::string>>; //(name, type)
+    auto GetVarExprs(const std::string& type, bool reference, const std::string& curArray = "") -> std::shared_ptr<const VarExprs>;
+    auto FindVarExprs(std::string_view prefix, const std::string& type, bool reference, const std::string& curArray = "") -> VarExprs;
 
 private:
     Var* FindVar(const std::string& name, const std::string& scope);
     auto MatchType(const std::string& name, std::string_view type, std::string_view match, bool reference, const std::string& curArray) -> std::vector<std::pair<std::string, std::string>>;
 
+    bool ReadPrevFile(const fs::path& path, std::string& content);
+    bool WriteChanged(const fs::path& path, const std::string& data, const std::string* prev, uint64_t& hash, std::string& err);
     void CreateH(std::ostream& out);
     void CreateCpp(std::ostream& out);
-    auto ExportH(std::ostream& out, std::istream& prev, const std::string& origHName, TopWindow* node) -> std::array<std::string, 3>;
-    void ExportCpp(std::ostream& out, std::istream& prev, const std::array<std::string, 3>& origNames, const std::map<std::string, std::string>& params, TopWindow* node, const std::string& code);
+    auto GetRuntimeHeaders(TopWindow* node) -> std::vector<std::string>;
+    auto ExportH(std::ostream& out, std::string_view prev, const std::string& origHName, TopWindow* node) -> std::array<std::string, 3>;
+    void ExportCpp(std::ostream& out, std::string_view prev, const std::array<std::string, 3>& origNames, const std::map<std::string, std::string>& params, TopWindow* node, const std::string& code);
     bool WriteStub(std::ostream& fout,    const std::string& id, TopWindow::Kind kind, TopWindow::Placement animPos, const std::map<std::string, std::string>& params = {}, const std::string& code = {});
+    auto CachePath(const std::string& fname) const -> fs::path;
+    auto ExportCode(TopWindow* node, const std::map<std::string, std::string>& params) const -> std::string;
+    void WriteCache(const std::string& fname, TopWindow* node, const std::map<std::string, std::string>& params, const std::string& code);
+    auto ReadCache(std::string_view data, std::map<std::string, std::string>& params, bool live) -> std::unique_ptr<TopWindow>;
     auto ImportCode(std::istream& in, const std::string& fname, std::map<std::string, std::string>& params) -> std::unique_ptr<TopWindow>;
 
     bool ParseFieldDecl(const std::string& stype, const std::vector<std::string>& line, int flags);
@@ -73,5 +90,9 @@ private:
     std::string m_name, m_vname, m_hname;
     std::string ctx_workingDir;
     int ctx_importVersion;
+    bool ctx_loadTextures = true;
     std::string m_error;
+    uint64_t m_fileHash[2] = {};
+    //GetVarExprs cache keyed by (type, reference, curArray), cleared on every fields change
+    std::map<std::tuple<std::string, bool, std::string>, std::shared_ptr<const VarExprs>> m_varExprs;
 };
\ No newline at end of file
@@ -18,12 +18,17 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <thread>
+#include <atomic>
 #if defined(IMGUI_IMPL_OPENGL_ES2)
 #include <GLES2/gl2.h>
 #endif
 #include <GLFW/glfw3.h> // Will drag system OpenGL headers
 #include <nfd.h>
 
+//out of line ImRad runtime is compiled here
+#define IMRAD_IMPLEMENTATION
+#include "imrad.h"
 #include "glfw_cursor.h"
 #include "node_standard.h"
 #include "cppgen.h"
@@ -66,10 +71,14 @@ struct File
     fs::file_time_type time[2];
     std::string styleName;
     std::string unit;
+    bool loading = false; //placeholder until its async import finishes
+    unsigned version = 0; //bumped on edits so cached views like code preview know to refresh
 };
 
 enum ProgramState { Run, Init, Shutdown };
 ProgramState programState;
+bool shutdownSavePrompted = false;
+bool shutdownSavePending = false; //combined save prompt waits for an answer
 std::string rootPath;
 std::string initErrors, showError;
 std::string uiFontName = "Roboto-Regular.ttf";
@@ -113,7 +122,9 @@ std::vector<std::pair<std::string, std::vector<TB_Button>>> tbButtons{
         { ICON_FA_SLIDERS, "Slider" },
         { ICON_FA_CIRCLE_HALF_STROKE, "ColorEdit" },
         { ICON_FA_BATTERY_HALF, "ProgressBar" },
+        { ICON_FA_CHART_LINE, "Plot" },
         { ICON_FA_IMAGE, "Image" },
+        { ICON_FA_RECEIPT, "LogView" },
         { ICON_FA_LEFT_RIGHT, "Spacer" },
         { ICON_FA_MINUS, "Separator" },
         { ICON_FA_EXPAND, "CustomWidget" },
@@ -139,20 +150,37 @@ void DoCancelShutdown()
 
     glfwSetWindowShouldClose(window, false);
     programState = Run;
+    shutdownSavePrompted = false;
+    shutdownSavePending = false;
     ImGui::GetIO().IniFilename = INI_FILE_NAME;
 }
 
+//versions are unique across tabs so caches can be keyed on them
+unsigned lastVersion = 0;
+
+void BumpVersion(File& tab)
+{
+    tab.version = ++lastVersion;
+}
+
+void MarkModified(File& tab)
+{
+    tab.modified = true;
+    BumpVersion(tab);
+}
+
 void DoReloadFile()
 {
     if (activeTab < 0)
         return;
     auto& tab = fileTabs[activeTab];
-    if (tab.fname == "" || !fs::is_regular_file(u8path(tab.fname)))
+    if (tab.fname == "" || tab.loading || !fs::is_regular_file(u8path(tab.fname)))
         return;
 
     std::map<std::string, std::string> params;
     std::string error;
     tab.rootNode = tab.codeGen.Import(tab.fname, params, error);
+    BumpVersion(tab);
     auto pit = params.find("style");
     tab.styleName = pit == params.end() ? DEFAULT_STYLE : pit->second;
     pit = params.find("unit");
@@ -182,7 +210,7 @@ void ReloadFile()
     if (activeTab < 0)
         return;
     auto& tab = fileTabs[activeTab];
-    if (tab.fname == "" || !fs::is_regular_file(u8path(tab.fname)))
+    if (tab.fname == "" || tab.loading || !fs::is_regular_file(u8path(tab.fname)))
         return;
     auto time1 = fs::last_write_time(u8path(tab.fname));
     std::error_code err;
@@ -225,7 +253,11 @@ void ActivateTab(int i)
     }
     activeTab = i;
     auto& tab = fileTabs[i];
-    ctx.selected = { tab.rootNode.get() };
+    BumpVersion(tab);
+    if (tab.loading)
+        ctx.selected.clear();
+    else
+        ctx.selected = { tab.rootNode.get() };
     ctx.codeGen = &tab.codeGen;
     ReloadFile();
 
@@ -297,6 +329,9 @@ void DoNewTemplate(int type, const std::string& name)
         case 0:
             fs::copy_file(u8path(rootPath + "/template/glfw/main.cpp"), p, fs::copy_options::overwrite_existing);
             break;
+        case 2:
+            fs::copy_file(u8path(rootPath + "/template/benchmark/main.cpp"), p, fs::copy_options::overwrite_existing);
+            break;
         case 1: {
             std::string jni = name;
             stx::replace(jni, '.', '_');
@@ -341,35 +376,43 @@ void NewTemplate(int type)
         DoNewTemplate(type, "");
 }
 
-bool DoOpenFile(const std::string& path, std::string* errs = nullptr)
+//part of file opening which can run on a worker thread
+//returns false when the file doesn't exist
+bool ImportFile(const std::string& path, File& file, std::string& error, bool loadTextures)
 {
-    File file;
     file.fname = path;
     if (u8string(u8path(file.fname).extension()).compare(0, 2, ".h")) {
         file.fname = file.codeGen.AltFName(file.fname);
     }
-    if (!fs::is_regular_file(u8path(path))) {
-        if (errs)
-            *errs += "Can't read '" + path + "'\n";
-        else {
-            messageBox.title = "ImRAD";
-            messageBox.message = "Can't read '" + path + "'";
-            messageBox.buttons = ImRad::Ok;
-            messageBox.OpenPopup();
-        }
+    if (!fs::is_regular_file(u8path(path)))
         return false;
-    }
 
     std::error_code err;
     file.time[0] = fs::last_write_time(u8path(file.fname), err);
     file.time[1] = fs::last_write_time(u8path(file.codeGen.AltFName(file.fname)), err);
     std::map<std::string, std::string> params;
-    std::string error;
-    file.rootNode = file.codeGen.Import(file.fname, params, error);
+    file.rootNode = file.codeGen.Import(file.fname, params, error, loadTextures);
     auto pit = params.find("style");
     file.styleName = pit == params.end() ? DEFAULT_STYLE : pit->second;
     pit = params.find("unit");
     file.unit = pit == params.end() ? DEFAULT_UNIT : pit->second;
+    return true;
+}
+
+//part of file opening which needs the UI thread
+bool FinishOpenFile(const std::string& path, File&& file, bool exists, std::string error, std::string* errs, bool activate)
+{
+    if (!exists) {
+        if (errs)
+            *errs += "Can't read '" + path + "'\n";
+        else {
+            messageBox.title = "ImRAD";
+            messageBox.message = "Can't read '" + path + "'";
+            messageBox.buttons = ImRad::Ok;
+            messageBox.OpenPopup();
+        }
+        return false;
+    }
     if (!file.rootNode) {
         if (errs)
             *errs += "Unsuccessful import of '" + path + "'\n";
@@ -400,7 +443,8 @@ bool DoOpenFile(const std::string& path, std::string* errs = nullptr)
     }
     int idx = int(it - fileTabs.begin());
     fileTabs[idx] = std::move(file);
-    ActivateTab(idx);
+    if (activate || idx == activeTab)
+        ActivateTab(idx);
 
     if (error != "") {
         if (errs)
@@ -415,6 +459,156 @@ bool DoOpenFile(const std::string& path, std::string* errs = nullptr)
     return true;
 }
 
+bool DoOpenFile(const std::string& path, std::string* errs = nullptr)
+{
+    File file;
+    std::string error;
+    bool exists = ImportFile(path, file, error, true);
+    return FinishOpenFile(path, std::move(file), exists, std::move(error), errs, true);
+}
+
+//session restore imports files on worker threads with their own CppGen
+//placeholder tabs are shown meanwhile and get replaced as imports finish
+struct OpenJob
+{
+    std::string path;
+    File file;
+    std::string error;
+    bool exists = false;
+    std::atomic<bool> done = false;
+    bool applied = false;
+};
+std::vector<std::unique_ptr<OpenJob>> openJobs;
+std::vector<std::thread> openThreads;
+std::atomic<size_t> openNext = 0;
+std::string openErrors;
+
+void QueueOpenFile(const std::string& path)
+{
+    File file;
+    file.fname = path;
+    if (u8string(u8path(file.fname).extension()).compare(0, 2, ".h"))
+        file.fname = file.codeGen.AltFName(file.fname);
+    if (stx::count_if(fileTabs, [&](const File& f) { return f.fname == file.fname; }))
+        return;
+    file.rootNode = std::make_unique<TopWindow>(UIContext::Defaults());
+    file.styleName = DEFAULT_STYLE;
+    file.unit = DEFAULT_UNIT;
+    file.loading = true;
+    fileTabs.push_back(std::move(file));
+
+    auto job = std::make_unique<OpenJob>();
+    job->path = path;
+    openJobs.push_back(std::move(job));
+}
+
+void StartOpenJobs()
+{
+    //active tab goes first
+    if (activeTab >= 0) {
+        auto it = stx::find_if(openJobs, [](const auto& job) {
+            return job->path == fileTabs[activeTab].fname ||
+                job->path == fileTabs[activeTab].codeGen.AltFName(fileTabs[activeTab].fname);
+            });
+        if (it != openJobs.end())
+            std::rotate(openJobs.begin(), it, it + 1);
+    }
+    openNext = 0;
+    auto worker = [] {
+        for (size_t i = openNext++; i < openJobs.size(); i = openNext++) {
+            auto& job = *openJobs[i];
+            job.exists = ImportFile(job.path, job.file, job.error, false);
+            job.done = true;
+        }
+    };
+    size_t nthreads = std::min<size_t>(openJobs.size(), std::max(1u, std::thread::hardware_concurrency()));
+    for (size_t i = 0; i < nthreads; ++i)
+        openThreads.emplace_back(worker);
+}
+
+//textures were skipped by worker threads
+void LoadTextures(File& file, std::string& error)
+{
+    UIContext tmp;
+    tmp.workingDir = u8string(u8path(file.fname).parent_path());
+    tmp.importState = 1;
+    tmp.root = file.rootNode.get();
+    tmp.parents = { tmp.root };
+    for (UINode* node : file.rootNode->GetAllChildren())
+        if (auto* image = dynamic_cast<Image*>(node))
+            image->RefreshTexture(tmp);
+    for (const std::string& e : tmp.errors)
+        error += e + "\n";
+}
+
+void ApplyOpenJob(OpenJob& job)
+{
+    job.applied = true;
+    auto it = stx::find_if(fileTabs, [&](const File& f) {
+        return f.loading && f.fname == job.file.fname;
+        });
+    if (it == fileTabs.end()) //closed or reopened meanwhile
+        return;
+
+    std::string err;
+    if (job.exists && job.file.rootNode)
+        LoadTextures(job.file, job.error);
+    if (!FinishOpenFile(job.path, std::move(job.file), job.exists, job.error, &err, false))
+    {
+        int idx = int(it - fileTabs.begin());
+        int active = activeTab;
+        ctx.selected.clear();
+        fileTabs.erase(it);
+        ActivateTab(active > idx ? active - 1 : active);
+    }
+    if (err != "") {
+        openErrors += u8string(u8path(job.path).filename()) + "\n\t";
+        openErrors += Replace(Trim(err), "\n", "\n\t");
+        openErrors += "\n";
+    }
+}
+
+//called every frame, swaps finished imports into their tabs
+void PollOpenJobs()
+{
+    if (openJobs.empty())
+        return;
+    if (openThreads.empty())
+        StartOpenJobs();
+
+    bool finished = true;
+    for (auto& job : openJobs) {
+        if (job->applied)
+            continue;
+        if (job->done)
+            ApplyOpenJob(*job);
+        else
+            finished = false;
+    }
+    if (!finished)
+        return;
+
+    for (auto& th : openThreads)
+        if (th.joinable())
+            th.join();
+    openThreads.clear();
+    openJobs.clear();
+    initErrors += openErrors;
+    openErrors = "";
+}
+
+//blocks until pending imports are swapped in so shutdown sees the final tabs
+void WaitOpenJobs()
+{
+    if (openJobs.empty())
+        return;
+    if (openThreads.empty())
+        StartOpenJobs();
+    for (auto& th : openThreads)
+        th.join();
+    PollOpenJobs();
+}
+
 void OpenFile()
 {
     nfdchar_t *outPath = NULL;
@@ -504,7 +698,7 @@ void CloseFile(int flags)
     }
 }
 
-void DoSaveFile(int flags)
+std::map<std::string, std::string> GetExportParams(const File& tab)
 {
     GLFWmonitor* monitor = glfwGetPrimaryMonitor();
     const GLFWvidmode* mode = glfwGetVideoMode(monitor);
@@ -516,12 +710,17 @@ void DoSaveFile(int flags)
     std::ostringstream os;
     os << dpi << "," << xscale;
 
-    auto& tab = fileTabs[activeTab];
-    std::map<std::string, std::string> params{
+    return {
         { "style", tab.styleName },
         { "unit", tab.unit },
         { "dpi-info", os.str() }
     };
+}
+
+void DoSaveFile(int flags)
+{
+    auto& tab = fileTabs[activeTab];
+    auto params = GetExportParams(tab);
     std::string error;
     if (!tab.codeGen.ExportUpdate(tab.fname, tab.rootNode.get(), params, error))
     {
@@ -619,6 +818,8 @@ bool SaveFileAs(int flags)
 bool SaveFile(int flags)
 {
     auto& tab = fileTabs[activeTab];
+    if (tab.loading)
+        return false;
     if (tab.fname == "") {
         return SaveFileAs(flags);
     }
@@ -628,37 +829,144 @@ bool SaveFile(int flags)
     }
 }
 
-//todo: dangerous because of no reloading
+//exports all named tabs in parallel
+//each worker touches only its own File (codeGen, rootNode) while the UI thread
+//waits. Results are applied and errors reported once everything has finished
+bool DoSaveAll()
+{
+    struct Job
+    {
+        File* tab;
+        std::map<std::string, std::string> params;
+        std::string error;
+        bool ok = false;
+    };
+    std::vector<Job> jobs;
+    for (auto& tab : fileTabs)
+        if (tab.fname != "" && !tab.loading)
+            jobs.push_back({ &tab, GetExportParams(tab) });
+    if (jobs.empty())
+        return true;
+
+    std::atomic<size_t> next = 0;
+    auto worker = [&] {
+        for (size_t i = next++; i < jobs.size(); i = next++) {
+            auto& job = jobs[i];
+            job.ok = job.tab->codeGen.ExportUpdate(job.tab->fname, job.tab->rootNode.get(), job.params, job.error);
+        }
+    };
+    size_t nthreads = std::min<size_t>(jobs.size(), std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < nthreads; ++i)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& th : threads)
+        th.join();
+
+    bool ok = true;
+    std::string errors;
+    for (const auto& job : jobs)
+    {
+        auto& tab = *job.tab;
+        if (job.ok) {
+            std::error_code err;
+            tab.modified = false;
+            tab.time[0] = fs::last_write_time(u8path(tab.fname), err);
+            tab.time[1] = fs::last_write_time(u8path(tab.codeGen.AltFName(tab.fname)), err);
+        }
+        else
+            ok = false;
+        if (job.error != "") {
+            errors += u8string(u8path(tab.fname).filename()) + "\n\t";
+            errors += Replace(Trim(job.error), "\n", "\n\t");
+            errors += "\n";
+        }
+    }
+
+    if (!ok)
+    {
+        DoCancelShutdown();
+        errorBox.title = "CodeGen";
+        errorBox.message = "Unsuccessful export due to errors";
+        errorBox.error = errors;
+        errorBox.OpenPopup();
+    }
+    else if (errors != "" && programState != Shutdown)
+    {
+        errorBox.title = "CodeGen";
+        errorBox.message = "Export finished with errors";
+        errorBox.error = errors;
+        errorBox.OpenPopup();
+    }
+    return ok;
+}
+
 void SaveAll()
 {
+    if (!DoSaveAll())
+        return;
+
+    //untitled tabs need to go through the file dialog one by one
     int tmp = activeTab;
     for (activeTab = 0; activeTab < fileTabs.size(); ++activeTab)
     {
-        if (!SaveFile())
+        if (fileTabs[activeTab].fname == "" && !SaveFileAs())
             break;
     }
     activeTab = tmp;
 }
 
+//live preview of the Draw() code, the export is cached and only redone
+//after edits of the active tab (tab.version)
+bool showCodePreview = false;
+struct
+{
+    const TopWindow* root = nullptr;
+    unsigned version = 0;
+    std::string code;
+}
+codePreview;
+
 void ShowCode()
 {
-    if (activeTab < 0)
-        return;
-    fs::path path = fs::temp_directory_path() / "imrad-preview.cpp";
-    std::ofstream fout(path);
-    fout << "// NOTE: This is just a preview of the Draw() method. To see the complete code\n"
-         << "// including class definition and event handlers inspect generated .h/cpp files\n\n";
-    ctx.ind = "";
-    auto* root = fileTabs[activeTab].rootNode.get();
-    root->Export(fout, ctx);
+    showCodePreview = true;
+    ImGui::SetWindowFocus("Code Preview");
+}
 
-    if (ctx.errors.size()) {
-        fout << "\n// Export finished with errors:\n";
-        for (const std::string& e : ctx.errors)
-            fout << "// " << e <<  "\n";
+void CodePreviewUI()
+{
+    if (!showCodePreview)
+        return;
+    if (ImGui::Begin("Code Preview", &showCodePreview) &&
+        activeTab >= 0 && !fileTabs[activeTab].loading)
+    {
+        auto& tab = fileTabs[activeTab];
+        if (tab.rootNode.get() != codePreview.root ||
+            tab.version != codePreview.version)
+        {
+            codePreview.root = tab.rootNode.get();
+            codePreview.version = tab.version;
+            //export into a scratch generator so field/varCounter state of
+            //the tab and the designer context stay untouched
+            CppGen gen = tab.codeGen;
+            UIContext ectx;
+            ectx.codeGen = &gen;
+            ectx.unit = tab.unit;
+            ectx.ind = "";
+            stx::string_ostream out;
+            tab.rootNode->Export(out, ectx);
+            if (ectx.errors.size()) {
+                out << "\n// Export finished with errors:\n";
+                for (const std::string& e : ectx.errors)
+                    out << "// " << e << "\n";
+            }
+            codePreview.code = std::move(out.str());
+        }
+        ImGui::BeginChild("code", { 0, 0 }, 0, ImGuiWindowFlags_HorizontalScrollbar);
+        ImGui::TextUnformatted(codePreview.code.data(), codePreview.code.data() + codePreview.code.size());
+        ImGui::EndChild();
     }
-    fout.close();
-    ShellExec(u8string(path));
+    ImGui::End();
 }
 
 void NewWidget(const std::string& name)
@@ -677,6 +985,7 @@ void NewWidget(const std::string& name)
             dynamic_cast<TopWindow*>(ctx.root)->flags |= ImGuiWindowFlags_MenuBar;
             ctx.root->children.insert(ctx.root->children.begin(), std::make_unique<MenuBar>(ctx));
             ctx.selected = { ctx.root->children[0]->children[0].get() };
+            MarkModified(fileTabs[activeTab]);
         }
         ctx.mode = UIContext::NormalSelection;
     }
@@ -696,6 +1005,7 @@ void NewWidget(const std::string& name)
         popup->label = "ContextMenu" + std::to_string(i + 1);
         ctx.root->children.insert(ctx.root->children.begin() + i, std::move(popup));
         ctx.mode = UIContext::NormalSelection;
+        MarkModified(fileTabs[activeTab]);
         ctx.selected = { ctx.root->children[i]->children[0].get() };
     }
     else
@@ -1067,6 +1377,7 @@ void OpenSettings()
     settingsDlg.pgFontSize = std::to_string((int)pgFontSize);
     settingsDlg.designFontName = designFontName.substr(0, designFontName.size() - 4);
     settingsDlg.designFontSize = std::to_string((int)designFontSize);
+    settingsDlg.designCache = CppGen::designCache;
     settingsDlg.OpenPopup([](ImRad::ModalResult)
         {
             uiFontName = settingsDlg.uiFontName + ".ttf";
@@ -1076,6 +1387,7 @@ void OpenSettings()
             pgFontSize = std::stof(settingsDlg.pgFontSize);
             designFontName = settingsDlg.designFontName + ".ttf";
             designFontSize = std::stof(settingsDlg.designFontSize);
+            CppGen::designCache = settingsDlg.designCache;
 
             ImGui::SaveIniSettingsToDisk(ImGui::GetIO().IniFilename);
             reloadStyle = true;
@@ -1119,6 +1431,7 @@ void DockspaceUI()
         ImGui::DockBuilderDockWindow("FileTabs", dock_id_top);
         ImGui::DockBuilderDockWindow("Hierarchy", dock_id_left);
         ImGui::DockBuilderDockWindow("Explorer", dock_id_left);
+        ImGui::DockBuilderDockWindow("Code Preview", dock_id_left);
         ImGui::DockBuilderDockWindow("Widgets", dock_id_right1);
         ImGui::DockBuilderDockWindow("Properties", dock_id_right2);
         ImGui::DockBuilderDockWindow("Events", dock_id_right2);
@@ -1241,6 +1554,10 @@ void ToolbarUI()
             NewTemplate(0);
         if (ImGui::MenuItem(ICON_FA_FILE_PEN "  main+java+manifest", "\tAndroid"))
             NewTemplate(1);
+        if (ImGui::MenuItem(ICON_FA_GAUGE_HIGH "  benchmark main.cpp", "\tHeadless"))
+            NewTemplate(2);
+        if (ImGui::IsItemHovered(ImGuiHoveredFlags_DelayNormal))
+            ImGui::SetTooltip("Measures per-frame cost of your windows without a renderer");
 
         ImGui::EndPopup();
     }
@@ -1303,7 +1620,7 @@ void ToolbarUI()
             {
                 reloadStyle = true;
                 assert(activeTab >= 0);
-                fileTabs[activeTab].modified = true;
+                MarkModified(fileTabs[activeTab]);
                 fileTabs[activeTab].styleName = styleNames[i].first;
             }
             if (i == 2 && i + 1 < styleNames.size())
@@ -1336,7 +1653,7 @@ void ToolbarUI()
     {
         auto& tab = fileTabs[activeTab];
         tab.unit = UNITS[usel];
-        tab.modified = true;
+        MarkModified(tab);
     }
     ImGui::SameLine();
     ImGui::SeparatorEx(ImGuiSeparatorFlags_Vertical);
@@ -1376,7 +1693,9 @@ void ToolbarUI()
         HorizLayout::ExpandSelection(ctx.selected, horizLayout.root);
         horizLayout.selected = ctx.selected;
         horizLayout.ctx = &ctx;
-        horizLayout.OpenPopup();
+        horizLayout.OpenPopup([](ImRad::ModalResult) {
+            MarkModified(fileTabs[activeTab]);
+            });
     }
     ImGui::EndDisabled();
     if (ImGui::IsItemHovered(ImGuiHoveredFlags_DelayNormal))
@@ -1463,6 +1782,8 @@ void TabsUI()
                 fname = UNTITLED + std::to_string(++untitled);
             if (tab.modified)
                 fname += " *";
+            if (tab.loading)
+                fname += " " ICON_FA_HOURGLASS_HALF;
             bool notClosed = true;
 
             if (ImGui::BeginTabItem(fname.c_str(), &notClosed, i == activeTab ? ImGuiTabItemFlags_SetSelected : 0))
@@ -1525,13 +1846,46 @@ void TabsUI()
     ImGui::End();
 }
 
+//flattened tree of the active tab, only visible rows get drawn
+struct
+{
+    const TopWindow* root = nullptr;
+    unsigned version = 0;
+    std::vector<UINode::TreeRow> rows;
+}
+hierarchy;
+
 void HierarchyUI()
 {
     //ImGui::PushFont(ctx.defaultFont); icons are FA
     ImGui::PushStyleVarX(ImGuiStyleVar_WindowPadding, 0);
     ImGui::Begin("Hierarchy");
-    if (activeTab >= 0 && fileTabs[activeTab].rootNode)
-        fileTabs[activeTab].rootNode->TreeUI(ctx);
+    if (activeTab >= 0 && fileTabs[activeTab].rootNode && !fileTabs[activeTab].loading)
+    {
+        auto& tab = fileTabs[activeTab];
+        if (hierarchy.root != tab.rootNode.get() || hierarchy.version != tab.version)
+        {
+            hierarchy.root = tab.rootNode.get();
+            hierarchy.version = tab.version;
+            hierarchy.rows.clear();
+            tab.rootNode->TreeRows(hierarchy.rows, 0);
+        }
+        float indent = ImGui::GetStyle().IndentSpacing;
+        ImGuiListClipper clipper;
+        clipper.Begin((int)hierarchy.rows.size());
+        while (clipper.Step())
+        {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+            {
+                const auto& row = hierarchy.rows[i];
+                if (row.level)
+                    ImGui::Indent(row.level * indent);
+                row.node->TreeUI(row, ctx);
+                if (row.level)
+                    ImGui::Unindent(row.level * indent);
+            }
+        }
+    }
     ImGui::End();
     ImGui::PopStyleVar();
 }
@@ -1616,9 +1970,54 @@ std::vector<std::string_view> GetCat(std::string_view pname)
     return cat;
 }
 
+//applies a value edited on the first selected widget to the rest of the selection
+//in one pass. Widgets of the same type share property indexes so only widgets
+//of other types need a lookup by name. The value is taken in its exported form
+//so no variables get created again and the caller marks the file modified once.
+//Cached layout of the design is invalidated once after the whole batch
+void SetSelectionProperty(bool pr, int index, const std::string& value)
+{
+    UINode* first = ctx.selected[0];
+    auto props = pr ? first->Properties() : first->Events();
+    std::string_view pname = props[index].name;
+    std::string tname = first->GetTypeName();
+    bool applied = false;
+    for (size_t i = 1; i < ctx.selected.size(); ++i)
+    {
+        UINode* node = ctx.selected[i];
+        auto nprops = pr ? node->Properties() : node->Events();
+        property_base* prop = nullptr;
+        if (node->GetTypeName() == tname &&
+            index < (int)nprops.size() && nprops[index].name == pname)
+            prop = nprops[index].property;
+        else {
+            auto it = stx::find_if(nprops, [&](const auto& p) { return p.name == pname; });
+            if (it != nprops.end())
+                prop = it->property;
+        }
+        if (prop) {
+            prop->set_from_arg(value);
+            applied = true;
+        }
+    }
+    if (applied && activeTab >= 0)
+        fileTabs[activeTab].rootNode->ResetLayout();
+}
+
+//parents chain and common property names of the selection, kept until
+//the selection or the tree changes
+struct
+{
+    std::vector<UINode*> selected;
+    unsigned version = 0;
+    std::vector<UINode*> parents;
+    std::vector<std::string_view> pnames[2];
+}
+selectionCache;
+
 void PropertyRowsUI(bool pr)
 {
-    if (ctx.selected.empty())
+    if (ctx.selected.empty() || activeTab < 0)
         return;
 
     int keyPressed = 0;
@@ -1692,39 +2091,52 @@ void PropertyRowsUI(bool pr)
         ImGui::TableSetupColumn("value", ImGuiTableColumnFlags_WidthStretch);
         ImGui::PushItemFlag(ImGuiItemFlags_NoNav, false); //Pop+Push doesn't work here
 
-        //find parents for widget::PropertyUI and BindingButton
-        if (ctx.selected.size() && ctx.root) {
-            UINode* cur = ctx.selected[0];
-            ctx.parents = { cur };
-            while (auto pinfo = ctx.root->FindChild(cur)) {
-                cur = pinfo->first;
-                ctx.parents.insert(ctx.parents.begin(), cur);
-            }
-        }
-        //determine common properties for a selection set
-        //todo: remember to clear out differing values
-        //todo: combine enabled state
-        std::vector<std::string_view> pnames;
-        for (auto* node : ctx.selected)
+        auto& sc = selectionCache;
+        if (sc.selected != ctx.selected || sc.version != fileTabs[activeTab].version)
         {
-            std::vector<std::string_view> pn;
-            auto props = pr ? node->Properties() : node->Events();
-            for (auto& p : props) {
-                if (ctx.selected.size() == 1 ||
-                    (p.name.size() > 3 && p.name.compare(p.name.size() - 3, 3, "##1")))
-                {
-                    pn.push_back(p.name);
+            sc.selected = ctx.selected;
+            sc.version = fileTabs[activeTab].version;
+            //find parents for widget::PropertyUI and BindingButton
+            sc.parents.clear();
+            if (ctx.root) {
+                UINode* cur = ctx.selected[0];
+                sc.parents = { cur };
+                while (auto pinfo = ctx.root->FindChild(cur)) {
+                    cur = pinfo->first;
+                    sc.parents.insert(sc.parents.begin(), cur);
                 }
             }
-            stx::sort(pn);
-            if (node == ctx.selected[0])
-                pnames = std::move(pn);
-            else {
-                std::vector<std::string_view> pres;
-                stx::set_intersection(pnames, pn, std::back_inserter(pres));
-                pnames = std::move(pres);
+            //determine common properties for a selection set
+            //todo: remember to clear out differing values
+            //todo: combine enabled state
+            for (int k = 0; k < 2; ++k)
+            {
+                auto& pnames = sc.pnames[k];
+                for (auto* node : ctx.selected)
+                {
+                    std::vector<std::string_view> pn;
+                    auto props = k ? node->Properties() : node->Events();
+                    for (auto& p : props) {
+                        if (ctx.selected.size() == 1 ||
+                            (p.name.size() > 3 && p.name.compare(p.name.size() - 3, 3, "##1")))
+                        {
+                            pn.push_back(p.name);
+                        }
+                    }
+                    stx::sort(pn);
+                    if (node == ctx.selected[0])
+                        pnames = std::move(pn);
+                    else {
+                        std::vector<std::string_view> pres;
+                        stx::set_intersection(pnames, pn, std::back_inserter(pres));
+                        pnames = std::move(pres);
+                    }
+                }
             }
         }
+        if (sc.parents.size())
+            ctx.parents = sc.parents;
+        const auto& pnames = sc.pnames[pr];
         std::vector<std::string_view> forceCatOpen;
         if (pr && keyPressed)
         {
@@ -1742,14 +2154,14 @@ void PropertyRowsUI(bool pr)
         ImGui::PushID(ctx.selected[0]);
         //edit first widget
         auto props = pr ? ctx.selected[0]->Properties() : ctx.selected[0]->Events();
-        bool copyChange = false;
+        int copyIndex = -1;
         std::string pval;
         std::vector<std::string_view> lastCat;
         std::vector<bool> catOpen;
         for (int i = 0; i < (int)props.size(); ++i)
         {
             const auto& prop = props[i];
-            if (!stx::count(pnames, prop.name))
+            if (!std::binary_search(pnames.begin(), pnames.end(), prop.name))
                 continue;
             std::vector<std::string_view> cat = GetCat(prop.name);
             bool forceSameRow = false;
@@ -1792,9 +2204,9 @@ void PropertyRowsUI(bool pr)
             }
             bool change = pr ? ctx.selected[0]->PropertyUI(i, ctx) : ctx.selected[0]->EventUI(i, ctx);
             if (change) {
-                fileTabs[activeTab].modified = true;
+                MarkModified(fileTabs[activeTab]);
                 if (props[i].property) {
-                    copyChange = true;
+                    copyIndex = i;
                     lastPropName = props[i].name; //todo: set lastPropName upon input focus as well
                     pval = props[i].property->to_arg();
                 }
@@ -1829,18 +2241,8 @@ void PropertyRowsUI(bool pr)
         }
 
         //copy changes to other widgets
-        if (copyChange)
-        {
-            for (size_t i = 1; i < ctx.selected.size(); ++i)
-            {
-                auto props = pr ? ctx.selected[i]->Properties() : ctx.selected[i]->Events();
-                for (auto& p : props)
-                {
-                    if (p.name == lastPropName)
-                        p.property->set_from_arg(pval);
-                }
-            }
-        }
+        if (copyIndex >= 0 && ctx.selected.size() > 1)
+            SetSelectionProperty(pr, copyIndex, pval);
     }
     ImGui::PopItemFlag();
     ImGui::PopFont();
@@ -1871,27 +2273,45 @@ void PropertyUI()
     ImGui::PopStyleColor(3);
 }
 
+//design editing dialogs flag their changes through ctx.modified so views
+//caching the export (hierarchy, code preview) get refreshed
+template <class Dlg>
+void DrawDesignDialog(Dlg& dlg)
+{
+    if (activeTab < 0) {
+        dlg.Draw();
+        return;
+    }
+    auto& tab = fileTabs[activeTab];
+    bool wasModified = tab.modified;
+    tab.modified = false;
+    dlg.Draw();
+    if (tab.modified)
+        BumpVersion(tab);
+    tab.modified |= wasModified;
+}
+
 void PopupUI()
 {
-    newFieldPopup.Draw();
+    DrawDesignDialog(newFieldPopup);
 
-    tableCols.Draw();
+    DrawDesignDialog(tableCols);
 
-    comboDlg.Draw();
+    DrawDesignDialog(comboDlg);
 
     messageBox.Draw();
 
     errorBox.Draw();
 
-    classWizard.Draw();
+    DrawDesignDialog(classWizard);
 
     settingsDlg.Draw();
 
     aboutDlg.Draw();
 
-    bindingDlg.Draw();
+    DrawDesignDialog(bindingDlg);
 
-    horizLayout.Draw();
+    DrawDesignDialog(horizLayout);
 
     inputName.Draw();
 }
@@ -1904,6 +2324,16 @@ void Draw()
         return;
 
     auto& tab = fileTabs[activeTab];
+    if (tab.loading)
+    {
+        size_t done = stx::count_if(openJobs, [](const auto& job) { return job->applied; });
+        ImGui::SetNextWindowPos((ctx.designAreaMin + ctx.designAreaMax) / 2, ImGuiCond_Always, { 0.5f, 0.5f });
+        ImGui::Begin("##Loading", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings);
+        ImGui::Text("Loading %s...", u8string(u8path(tab.fname).filename()).c_str());
+        ImGui::ProgressBar(openJobs.empty() ? 1.f : (float)done / openJobs.size(), { 250, 0 });
+        ImGui::End();
+        return;
+    }
     auto tmpStyle = ImGui::GetStyle();
     ImGui::GetStyle() = ctx.style;
     ImGui::GetStyle().Colors[ImGuiCol_TitleBg] = ImGui::GetStyle().Colors[ImGuiCol_TitleBgActive];
@@ -1915,7 +2345,13 @@ void Draw()
     ctx.workingDir = u8string(u8path(tab.fname).parent_path());
     ctx.unit = tab.unit;
     ctx.modified = &tab.modified;
+    //widgets flag their own edits (dragging, resizing) through ctx.modified
+    bool wasModified = tab.modified;
+    tab.modified = false;
     tab.rootNode->Draw(ctx);
+    if (tab.modified)
+        BumpVersion(tab);
+    tab.modified |= wasModified;
 
     if (ctx.isAutoSize && ctx.layoutHash != ctx.prevLayoutHash)
     {
@@ -1974,7 +2410,7 @@ RemoveSelected()
         return {};
 
     std::vector<std::unique_ptr<Widget>> remove;
-    tab.modified = true;
+    MarkModified(tab);
     auto pi1 = tab.rootNode->FindChild(sortedSel[0]);
     for (UINode* node : sortedSel)
     {
@@ -2017,6 +2453,8 @@ RemoveSelected()
 
 void Work()
 {
+    PollOpenJobs();
+
     if (ImGui::GetTopMostAndVisiblePopupModal())
         return;
 
@@ -2039,7 +2477,37 @@ void Work()
 
     if (programState == Shutdown)
     {
-        CloseFile();
+        WaitOpenJobs();
+
+        //offer to save all named files at once so they can be exported in parallel
+        int count = (int)stx::count_if(fileTabs, [](const File& f) {
+            return f.modified && f.fname != "";
+            });
+        if (count >= 2 && !shutdownSavePrompted)
+        {
+            shutdownSavePrompted = true;
+            shutdownSavePending = true;
+            messageBox.title = "Confirmation";
+            messageBox.message = "Save changes to " + std::to_string(count) + " files?";
+            messageBox.buttons = ImRad::Yes | ImRad::No | ImRad::Cancel;
+            messageBox.OpenPopup([](ImRad::ModalResult mr) {
+                shutdownSavePending = false;
+                if (mr == ImRad::Yes)
+                    DoSaveAll();
+                else if (mr == ImRad::No) {
+                    for (auto& tab : fileTabs)
+                        if (tab.fname != "")
+                            tab.modified = false;
+                }
+                else
+                    DoCancelShutdown();
+                });
+        }
+        else if (!shutdownSavePending)
+        {
+            //tabs are closed one by one only after the combined prompt was answered
+            CloseFile();
+        }
     }
 
     if (ctx.mode == UIContext::PickPoint)
@@ -2091,7 +2559,7 @@ void Work()
                 clipboard.push_back(std::move(clone));
             }
             activeButton = "";
-            fileTabs[activeTab].modified = true;
+            MarkModified(fileTabs[activeTab]);
             ImGui::GetIO().MouseReleased[ImGuiMouseButton_Left] = false; //eat event
         }
     }
@@ -2214,7 +2682,7 @@ void Work()
             }
             ctx.mode = UIContext::NormalSelection;
             activeButton = "";
-            fileTabs[activeTab].modified = true;
+            MarkModified(fileTabs[activeTab]);
             ImGui::GetIO().MouseReleased[ImGuiMouseButton_Left] = false; //eat event
         }
     }
@@ -2274,6 +2742,7 @@ void Work()
                 if (!pos)
                     return;
                 UINode* parent = pos->first;
+                MarkModified(fileTabs[activeTab]);
                 auto* child = parent->children[pos->second].get();
                 auto* left = pos->second ? parent->children[pos->second - 1].get() : nullptr;
                 auto* right = pos->second + 1 < parent->children.size() ? parent->children[pos->second + 1].get() : nullptr;
@@ -2336,6 +2805,7 @@ void Work()
                 if (!pos)
                     return;
                 UINode* parent = pos->first;
+                MarkModified(fileTabs[activeTab]);
                 auto* child = parent->children[pos->second].get();
                 auto* right = pos->second + 1 < parent->children.size() ? parent->children[pos->second + 1].get() : nullptr;
                 int ncols = parent->ColumnCount(ctx);
@@ -2425,7 +2895,12 @@ void AddINIHandler()
         {
             if (programState != Init)
                 return;
-            if (!strcmp((const char*)entry, "Recent")) {
+            if (!strcmp((const char*)entry, "Settings")) {
+                //comes first so it applies to the files opened below
+                if (!strncmp(line, "DesignCache=", 12))
+                    CppGen::designCache = std::atoi(line + 12);
+            }
+            else if (!strcmp((const char*)entry, "Recent")) {
                 int i;
                 if (sscanf(line, "File%d=", &i) == 1) {
                     std::string fname = line + std::string_view(line).find('=') + 1;
@@ -2433,13 +2908,7 @@ void AddINIHandler()
                         fileTabs.clear();
                         ActivateTab(-1);
                     }
-                    std::string err;
-                    DoOpenFile(fname, &err);
-                    if (err != "") {
-                        initErrors += u8string(u8path(fname).filename()) + "\n\t";
-                        initErrors += Replace(Trim(err), "\n", "\n\t");
-                        initErrors += "\n";
-                    }
+                    QueueOpenFile(fname);
                 }
                 else if (sscanf(line, "ActiveTab=%d", &i) == 1) {
                     ActivateTab(i);
@@ -2476,6 +2945,10 @@ void AddINIHandler()
     ini_handler.ApplyAllFn = nullptr;
     ini_handler.WriteAllFn = [](ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
         {
+            buf->append("[ImRAD][Settings]\n");
+            buf->appendf("DesignCache=%d\n", (int)CppGen::designCache);
+            buf->append("\n");
+
             buf->append("[ImRAD][Recent]\n");
             int active = activeTab;
             int count = 0;
@@ -2688,6 +3161,7 @@ int main(int argc, const char* argv[])
         HierarchyUI();
         ExplorerUI();
         PropertyUI();
+        CodePreviewUI();
         PopupUI();
         Work();
         Draw(); //last
@@ -3,11 +3,8 @@
 #include <vector>
 #include <memory>
 #include <functional> //for ModalPopup callback
-#include <fstream> //Save/LoadStyle
-#include <filesystem> //Save/LoadStyle
-#include <iomanip> //std::quoted
-#include <sstream>
-#include <map>
+#include <map> //Save/LoadStyle
+#include <algorithm>
 #include <imgui.h>
 #include <imgui_internal.h> //CurrentItemFlags, GetCurrentWindow, PushOverrideID
 #include <misc/cpp/imgui_stdlib.h> //for Input(std::string)
@@ -19,18 +16,34 @@
 #endif
 
 #ifdef IMRAD_WITH_GLFW
-#include <GLFW/glfw3.h> //enables kind=MainWindow
-#ifndef GL_CLAMP_TO_EDGE
-#define GL_CLAMP_TO_EDGE 0x812F
-#endif
-#ifdef IMRAD_WITH_STB
-#include <stb_image.h> //for LoadTextureFromFile
-#endif
+struct GLFWwindow; //enables kind=MainWindow, generated code includes glfw3.h
 #endif
 
 #define IMRAD_INPUTTEXT_EVENT(clazz, member) \
     [](ImGuiInputTextCallbackData* data) { return ((clazz*)data->UserData)->member(*data); }, this
 
+#define IMRAD_ROW_EVENT(member) \
+    [this](const auto& args) { return member(args); }
+
+//ID hashed at compile time, same as ImGui::GetID(str) with seed on the ID stack
+#define IMRAD_ID(str, seed) \
+    std::integral_constant<ImGuiID, ImRad::HashStr(str, seed)>::value
+
+//frame cost timers emitted for windows with profile=true
+//they compile to nothing unless IMRAD_WITH_PROFILER is defined
+#ifdef IMRAD_WITH_PROFILER
+#include <chrono>
+#include <atomic>
+#define IMRAD_CONCAT2(a, b) a##b
+#define IMRAD_CONCAT(a, b) IMRAD_CONCAT2(a, b)
+//times the rest of the enclosing scope
+#define IMRAD_PROFILE_SCOPE(name) \
+    static ImRad::ProfileEntry& IMRAD_CONCAT(imradProfEntry, __LINE__) = ImRad::GetProfileEntry(name); \
+    ImRad::ProfileScope IMRAD_CONCAT(imradProfScope, __LINE__)(IMRAD_CONCAT(imradProfEntry, __LINE__))
+#else
+#define IMRAD_PROFILE_SCOPE(name)
+#endif
+
 namespace ImRad {
 
 using Int2 = int[2];
@@ -92,6 +105,33 @@ struct Texture
     explicit operator bool() const { return id != 0; }
 };
 
+//constexpr version of ImHashStr incl. "###" handling
+constexpr ImU32 HashStrStep(ImU32 crc, unsigned char c)
+{
+#ifdef IMGUI_ENABLE_SSE4_2_CRC
+    constexpr ImU32 POLY = 0x82F63B78; //crc32c used by _mm_crc32_u8
+#else
+    constexpr ImU32 POLY = 0xEDB88320; //GCrc32LookupTable
+#endif
+    crc ^= c;
+    for (int k = 0; k < 8; ++k)
+        crc = (crc >> 1) ^ (POLY & (0u - (crc & 1)));
+    return crc;
+}
+
+constexpr ImGuiID HashStr(std::string_view str, ImGuiID seed = 0)
+{
+    seed = ~seed;
+    ImU32 crc = seed;
+    for (size_t i = 0; i < str.size(); ++i)
+    {
+        if (str[i] == '#' && i + 2 < str.size() && str[i + 1] == '#' && str[i + 2] == '#')
+            crc = seed;
+        crc = HashStrStep(crc, (unsigned char)str[i]);
+    }
+    return ~crc;
+}
+
 struct CustomWidgetArgs
 {
     ImVec2 size;
@@ -100,6 +140,18 @@ struct CustomWidgetArgs
     CustomWidgetArgs(float x, float y) : size(x, y) {}
 };
 
+struct CompareRowsArgs
+{
+    int row1, row2; //container indexes
+    int column; //ImGuiTableColumnSortSpecs::ColumnIndex
+};
+
+struct FilterRowArgs
+{
+    int row; //container index
+    const ImGuiTextFilter& filter;
+};
+
 struct IOUserData
 {
     //to UI
@@ -322,6 +374,44 @@ private:
 using HBox = BoxLayout<true>;
 using VBox = BoxLayout<false>;
 
+//skips consecutive rows of widgets which are scrolled out of view
+//block extents are remembered from the last frame a block was submitted
+//and replaced by a Dummy item of the same size
+struct CullBlocks
+{
+    void Reset()
+    {
+        blocks.clear();
+    }
+    bool Begin(int i)
+    {
+        if (i >= (int)blocks.size())
+            blocks.resize(i + 1, { 0, 0 });
+        cur = i;
+        start = ImGui::GetCursorScreenPos();
+        const ImVec2& sz = blocks[i];
+        if (sz.y <= 0 || ImGui::IsRectVisible({ std::max(sz.x, 1.f), sz.y }))
+            return true;
+        //Dummy adds ItemSpacing which is already part of the measured height
+        ImGui::Dummy({ sz.x, std::max(sz.y - ImGui::GetStyle().ItemSpacing.y, 0.f) });
+        return false;
+    }
+    //call after the last row of a submitted block
+    void End()
+    {
+        ImGuiWindow* window = ImGui::GetCurrentWindow();
+        blocks[cur] = {
+            window->DC.CursorMaxPos.x - start.x,
+            window->DC.CursorPos.y - start.y
+        };
+    }
+
+private:
+    std::vector<ImVec2> blocks;
+    ImVec2 start;
+    int cur = 0;
+};
+
 //------------------------------------------------------------------------
 
 inline IOUserData& GetUserData() 
@@ -397,6 +487,129 @@ inline bool Selectable(const char* label, bool* selected, ImGuiSelectableFlags f
     return false;
 }
 
+//ID based variants emitted for windows with hashIds
+//id must equal ImGui::GetID(label), exported code computes it with IMRAD_ID
+//widgets are submitted with an empty label under PushOverrideID(id) because ImGui
+//hashes an empty label to the ID stack top, the label is only measured and rendered
+inline bool Button(ImGuiID id, const char* label, const ImVec2& size_arg = { 0, 0 })
+{
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    const ImGuiStyle& style = ImGui::GetStyle();
+    ImVec2 labelSize = ImGui::CalcTextSize(label, nullptr, true);
+    ImVec2 size = ImGui::CalcItemSize(size_arg, labelSize.x + style.FramePadding.x * 2, labelSize.y + style.FramePadding.y * 2);
+    ImGui::PushOverrideID(id);
+    bool pressed = ImGui::Button("", size);
+    ImGui::PopID();
+    if (ImGui::IsItemVisible()) {
+        const ImRect& bb = GImGui->LastItemData.Rect;
+        ImVec2 textMin(bb.Min.x + style.FramePadding.x, bb.Min.y + style.FramePadding.y);
+        ImVec2 textMax(bb.Max.x - style.FramePadding.x, bb.Max.y - style.FramePadding.y);
+        ImGui::RenderTextClipped(textMin, textMax, label, nullptr, &labelSize, style.ButtonTextAlign, &bb);
+    }
+    return pressed;
+}
+
+//same sizing rules as ImRad::Selectable above
+inline bool Selectable(ImGuiID id, const char* label, bool selected, ImGuiSelectableFlags flags, const ImVec2& size)
+{
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    ImVec2 labelSize = ImGui::CalcTextSize(label, nullptr, true);
+    ImVec2 sz = ImGui::CalcItemSize(size, 0, 0);
+    if (!sz.x && !(flags & ImGuiSelectableFlags_SpanAllColumns))
+        sz.x = labelSize.x;
+    if (!sz.y)
+        sz.y = labelSize.y;
+    ImVec2 pos = window->DC.CursorPos;
+    pos.y += window->DC.CurrLineTextBaseOffset;
+    ImGui::PushOverrideID(id);
+    bool pressed = ImGui::Selectable("", selected, flags, sz);
+    ImGui::PopID();
+    if (ImGui::IsItemVisible()) {
+        //text rectangle as computed by ImGui::Selectable
+        bool spanAll = flags & ImGuiSelectableFlags_SpanAllColumns;
+        float minX = spanAll ? window->ParentWorkRect.Min.x : pos.x;
+        float maxX = spanAll ? window->ParentWorkRect.Max.x : window->WorkRect.Max.x;
+        if (!sz.x || (flags & ImGuiSelectableFlags_SpanAvailWidth))
+            sz.x = std::max(labelSize.x, maxX - minX);
+        if (flags & ImGuiSelectableFlags_Disabled)
+            ImGui::BeginDisabled();
+        ImGui::RenderTextClipped(pos, { minX + sz.x, pos.y + sz.y }, label, nullptr, &labelSize,
+            ImGui::GetStyle().SelectableTextAlign, &GImGui->LastItemData.Rect);
+        if (flags & ImGuiSelectableFlags_Disabled)
+            ImGui::EndDisabled();
+    }
+    return pressed;
+}
+
+inline bool Selectable(ImGuiID id, const char* label, bool* selected, ImGuiSelectableFlags flags, const ImVec2& size)
+{
+    if (Selectable(id, label, *selected, flags, size)) {
+        *selected = !*selected;
+        return true;
+    }
+    return false;
+}
+
+//clicking the label toggles too so the item covers it like ImGui::Checkbox
+inline bool Checkbox(ImGuiID id, const char* label, bool* v)
+{
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+    const ImGuiStyle& style = ImGui::GetStyle();
+    ImVec2 labelSize = ImGui::CalcTextSize(label, nullptr, true);
+    float square = ImGui::GetFrameHeight();
+    ImVec2 pos = window->DC.CursorPos;
+    ImRect bb(pos.x, pos.y,
+        pos.x + square + (labelSize.x > 0 ? style.ItemInnerSpacing.x + labelSize.x : 0),
+        pos.y + std::max(square, labelSize.y + style.FramePadding.y * 2));
+    ImGui::ItemSize(bb, style.FramePadding.y);
+    if (!ImGui::ItemAdd(bb, id))
+        return false;
+    bool hovered, held;
+    bool pressed = ImGui::ButtonBehavior(bb, id, &hovered, &held);
+    if (pressed) {
+        *v = !*v;
+        ImGui::MarkItemEdited(id);
+    }
+    ImGui::RenderNavCursor(bb, id);
+    ImGuiCol col = held && hovered ? ImGuiCol_FrameBgActive : hovered ? ImGuiCol_FrameBgHovered : ImGuiCol_FrameBg;
+    ImGui::RenderFrame(pos, { pos.x + square, pos.y + square }, ImGui::GetColorU32(col), true, style.FrameRounding);
+    if (*v) {
+        float pad = std::max(1.f, IM_TRUNC(square / 6));
+        ImGui::RenderCheckMark(window->DrawList, { pos.x + pad, pos.y + pad }, ImGui::GetColorU32(ImGuiCol_CheckMark), square - pad * 2);
+    }
+    if (labelSize.x > 0)
+        ImGui::RenderText({ pos.x + square + style.ItemInnerSpacing.x, pos.y + style.FramePadding.y }, label);
+    GImGui->LastItemData.StatusFlags |= ImGuiItemStatusFlags_Checkable | (*v ? ImGuiItemStatusFlags_Checked : 0);
+    return pressed;
+}
+
+//visible labels are laid out by ImGui so only hidden ones take the ID path
+inline bool InputText(ImGuiID id, const char* label, std::string* str, ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = nullptr, void* user_data = nullptr)
+{
+    if (ImGui::FindRenderedTextEnd(label) != label)
+        return ImGui::InputText(label, str, flags, callback, user_data);
+    ImGui::PushOverrideID(id);
+    bool changed = ImGui::InputText("", str, flags, callback, user_data);
+    ImGui::PopID();
+    return changed;
+}
+
+inline bool InputTextWithHint(ImGuiID id, const char* label, const char* hint, std::string* str, ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = nullptr, void* user_data = nullptr)
+{
+    if (ImGui::FindRenderedTextEnd(label) != label)
+        return ImGui::InputTextWithHint(label, hint, str, flags, callback, user_data);
+    ImGui::PushOverrideID(id);
+    bool changed = ImGui::InputTextWithHint("", hint, str, flags, callback, user_data);
+    ImGui::PopID();
+    return changed;
+}
+
 inline bool Splitter(bool split_horiz, float thickness, float* position, float min_size1, float min_size2, float splitter_long_axis_size = -1.0f)
 {
     using namespace ImGui;
@@ -604,7 +817,264 @@ inline void PopIgnoreWindowPadding(const IgnoreWindowPaddingData& data)
 //0 - nothing happening or scrolling continues
 //1 - scrolling started
 //2 - scrolling ended
-inline int ScrollWhenDragging(bool drawScrollbars)
+int ScrollWhenDragging(bool drawScrollbars);
+
+//this currently
+//* allows to move popups on the screen side further out of the screen just to give it responsive feeling
+//* detects modal/popup close event
+//returns
+// 0 - close popup either by sliding or clicking outside
+// 1 - nothing happening
+// 2 - todo: maximize up/down popup
+int MoveWhenDragging(ImGuiDir dir, ImVec2& pos, float& dimBgRatio);
+
+//todo
+//intended for android
+//original version doesn't respect ioUserData.displayMinMaxOffset
+void RenderDimmedBackground(const ImRect& rect, float alpha_mul);
+
+void RenderFilledWindowCorners(ImDrawFlags fl);
+
+//like TextUnformatted but word wrap positions are cached between frames
+//and only lines intersecting the clip rect are rendered
+void TextWrapCached(const char* text, const char* text_end = nullptr);
+
+//iterates visible items only so long lists cost nothing off screen
+//for (int i : ImRad::ClipRange(n))
+class ClipRange
+{
+public:
+    struct iterator
+    {
+        ImGuiListClipper* clipper;
+        int i;
+
+        int operator* () const { return i; }
+        bool operator!= (const iterator& it) const { return i != it.i; }
+        iterator& operator++ ()
+        {
+            ++i;
+            Skip();
+            return *this;
+        }
+        void Skip()
+        {
+            while (i >= clipper->DisplayEnd) {
+                if (!clipper->Step()) {
+                    i = -1;
+                    break;
+                }
+                i = clipper->DisplayStart;
+            }
+        }
+    };
+
+    ClipRange(size_t n) { clipper.Begin((int)n); }
+    iterator begin()
+    {
+        iterator it{ &clipper, clipper.DisplayEnd };
+        it.Skip();
+        return it;
+    }
+    iterator end() { return { &clipper, -1 }; }
+
+private:
+    ImGuiListClipper clipper;
+};
+
+inline std::string FormatFallback(std::string_view fmt)
+{
+    return std::string(fmt);
+}
+
+template <class A1, class... A>
+std::string FormatFallback(std::string_view fmt, A1&& arg, A&&... args)
+{
+    //todo
+    std::string s;
+    for (size_t i = 0; i < fmt.size(); ++i)
+    {
+        if (fmt[i] == '{') {
+            if (i + 1 == fmt.size())
+                break;
+            if (fmt[i + 1] == '{') {
+                s += '{';
+                ++i;
+            }
+            else {
+                auto j = fmt.find('}', i + 1);
+                if (j == std::string::npos)
+                    break;
+                if constexpr (std::is_same_v<std::decay_t<A1>, std::string>)
+                    s += arg;
+                else if constexpr (std::is_same_v<std::decay_t<A1>, const char*> ||
+                                    std::is_same_v<std::decay_t<A1>, char*>)
+                    s += arg;
+                else if constexpr (std::is_same_v<std::decay_t<A1>, char>)
+                    s += arg;
+                else
+                    s += std::to_string(arg);
+                return s + FormatFallback(fmt.substr(j + 1), args...);
+            }
+        }
+        else
+            s += fmt[i];
+    }
+    return s;
+}
+
+#ifdef IMRAD_WITH_FMT
+template <class... A>
+std::string Format(std::string_view fmt, A&&... args)
+{
+    return fmt::format(fmt, std::forward<A>(args)...);
+}
+
+#elif __cplusplus >= 202002L && __has_include(<format>)
+
+//only support format_string version for compile time checks
+template <class... A>
+std::string Format(std::format_string<A...> fmt, A&&... args)
+{
+    return std::format(fmt, std::forward<A>(args)...);
+}
+
+#else
+
+template <class... A>
+std::string Format(std::string_view fmt, A&&... args)
+{
+    return FormatFallback(fmt, std::forward<A>(args)...);
+}
+#endif
+
+#if (defined (IMRAD_WITH_GLFW) || defined(ANDROID)) && defined(IMRAD_WITH_STB)
+// Simple helper function to load an image into a OpenGL texture with common settings
+// https://github.com/ocornut/imgui/wiki/Image-Loading-and-Displaying-Examples
+Texture LoadTextureFromFile(
+    std::string_view filename,
+    int minFilter = 0x2601, //GL_LINEAR
+    int magFilter = 0x2601, //GL_LINEAR
+    int wrapS = 0x812F, //GL_CLAMP_TO_EDGE, required on WebGL for non power-of-two textures
+    int wrapT = 0x812F //GL_CLAMP_TO_EDGE
+);
+#else
+Texture LoadTextureFromFile(std::string_view filename);
+#endif
+
+//For debugging pruposes
+void SaveStyle(std::string_view spath, const ImGuiStyle* src = nullptr, const std::map<std::string, std::string>& extra = {});
+
+//This function can be used in your code to load style and fonts from the INI file
+//It is also used by ImRAD when switching themes
+void LoadStyle(std::string_view spath, float fontScaling = 1, ImGuiStyle* dst = nullptr, std::map<std::string, ImFont*>* fontMap = nullptr, std::map<std::string, std::string>* extra = nullptr);
+
+//This function will be called from the generated code when alternate font is used
+ImFont* GetFontByName(std::string_view name);
+
+#ifdef IMRAD_WITH_PROFILER
+//per call site timings, ring buffered over recent frames
+struct ProfileEntry
+{
+    static constexpr int HISTORY = 120;
+
+    std::atomic<const char*> name = nullptr;
+    std::atomic<int64_t> accum = 0; //ns spent in the current frame
+    std::atomic<int> frame = -1;
+    std::atomic<int64_t> history[HISTORY] = {};
+    std::atomic<int> head = 0;
+
+    void Add(int64_t ns)
+    {
+        //first sample of a new frame publishes the previous one
+        int fc = ImGui::GetFrameCount();
+        int last = frame.load(std::memory_order_relaxed);
+        if (last != fc && frame.compare_exchange_strong(last, fc, std::memory_order_relaxed))
+        {
+            int64_t prev = accum.exchange(0, std::memory_order_relaxed);
+            if (last >= 0) {
+                int h = head.load(std::memory_order_relaxed);
+                history[h % HISTORY].store(prev, std::memory_order_relaxed);
+                head.store(h + 1, std::memory_order_release);
+            }
+        }
+        accum.fetch_add(ns, std::memory_order_relaxed);
+    }
+};
+
+struct ProfileRegistry
+{
+    static constexpr int MAX_ENTRIES = 256;
+    ProfileEntry entries[MAX_ENTRIES + 1]; //last one collects overflow
+    std::atomic<int> count = 0;
+};
+
+inline ProfileRegistry& GetProfileRegistry()
+{
+    static ProfileRegistry registry;
+    return registry;
+}
+
+//called once per call site through a static reference
+inline ProfileEntry& GetProfileEntry(const char* name)
+{
+    auto& reg = GetProfileRegistry();
+    int i = reg.count.fetch_add(1, std::memory_order_relaxed);
+    if (i >= ProfileRegistry::MAX_ENTRIES)
+        return reg.entries[ProfileRegistry::MAX_ENTRIES];
+    reg.entries[i].name.store(name, std::memory_order_release);
+    return reg.entries[i];
+}
+
+inline int64_t ProfileNow()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+struct ProfileScope
+{
+    ProfileScope(ProfileEntry& e) : entry(e), start(ProfileNow()) {}
+    ~ProfileScope() { entry.Add(ProfileNow() - start); }
+
+    ProfileEntry& entry;
+    int64_t start;
+};
+
+//overlay with last/average/max cost of every timed window and container
+void ShowProfiler(bool* p_open = nullptr);
+#else
+inline void ShowProfiler(bool* = nullptr) {}
+#endif
+
+}
+
+//------------------------------------------------------------------------
+//out of line part of the runtime
+//#define IMRAD_IMPLEMENTATION in exactly one source file before including imrad.h
+#ifdef IMRAD_IMPLEMENTATION
+#include <fstream> //Save/LoadStyle
+#include <filesystem> //Save/LoadStyle
+#include <iomanip> //std::quoted
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map> //TextWrapCached, PlotLines
+#if defined(__ARM_NEON) && !defined(IMGUI_ENABLE_SSE)
+#include <arm_neon.h> //PlotLines
+#endif
+
+#ifdef IMRAD_WITH_GLFW
+#include <GLFW/glfw3.h>
+#elif defined(ANDROID)
+#include <GLES3/gl3.h>
+#endif
+#ifdef IMRAD_WITH_STB
+#include <stb_image.h> //for LoadTextureFromFile
+#endif
+
+namespace ImRad {
+
+int ScrollWhenDragging(bool drawScrollbars)
 {
     static int dragState = 0;
 
@@ -653,14 +1123,7 @@ inline int ScrollWhenDragging(bool drawScrollbars)
     return 0;
 }
 
-//this currently
-//* allows to move popups on the screen side further out of the screen just to give it responsive feeling
-//* detects modal/popup close event
-//returns
-// 0 - close popup either by sliding or clicking outside
-// 1 - nothing happening
-// 2 - todo: maximize up/down popup
-inline int MoveWhenDragging(ImGuiDir dir, ImVec2& pos, float& dimBgRatio)
+int MoveWhenDragging(ImGuiDir dir, ImVec2& pos, float& dimBgRatio)
 {
     static int dragState = 0;
     static ImVec2 mousePos[3];
@@ -746,10 +1209,7 @@ inline int MoveWhenDragging(ImGuiDir dir, ImVec2& pos, float& dimBgRatio)
     return 1;
 }
 
-//todo
-//intended for android
-//original version doesn't respect ioUserData.displayMinMaxOffset
-inline void RenderDimmedBackground(const ImRect& rect, float alpha_mul)
+void RenderDimmedBackground(const ImRect& rect, float alpha_mul)
 {
     static ImVec4 origDimColor = { 0, 0, 0, 0.5f };
     ImVec4& styleDimColor = ImGui::GetStyle().Colors[ImGuiCol_ModalWindowDimBg];
@@ -812,7 +1272,7 @@ inline void RenderDimmedBackground(const ImRect& rect, float alpha_mul)
     dl->PopClipRect();
 }
 
-inline void RenderFilledWindowCorners(ImDrawFlags fl)
+void RenderFilledWindowCorners(ImDrawFlags fl)
 {
     ImDrawList* dl = ImGui::GetWindowDrawList();
     ImGuiWindow* win = ImGui::GetCurrentWindow();
@@ -838,88 +1298,381 @@ inline void RenderFilledWindowCorners(ImDrawFlags fl)
     ImGui::PopClipRect();
 }
 
-inline std::string FormatFallback(std::string_view fmt)
+//line breaks of a wrapped text computed for one (text, width, font, size) combination
+struct WrapLayout
 {
-    return std::string(fmt);
+    std::vector<std::pair<int, int>> lines; //[begin, end) offsets
+    float width = 0;
+    int lastFrame = 0;
+    //inputs are kept to detect key collisions
+    std::string text;
+    float wrapWidth = 0;
+    ImFont* font = nullptr;
+    float size = 0;
+};
+
+struct WrapCache
+{
+    static constexpr int MAX_AGE = 60; //frames
+
+    std::unordered_map<ImGuiID, WrapLayout> layouts;
+    int lastGC = 0;
+};
+
+inline WrapCache& GetWrapCache()
+{
+    static WrapCache cache;
+    return cache;
 }
 
-template <class A1, class... A>
-std::string FormatFallback(std::string_view fmt, A1&& arg, A&&... args)
+inline const WrapLayout& GetWrapLayout(const char* text, const char* text_end, float wrapWidth)
 {
-    //todo
-    std::string s;
-    for (size_t i = 0; i < fmt.size(); ++i)
+    ImFont* font = ImGui::GetFont();
+    float size = ImGui::GetFontSize();
+    ImGuiID key = ImHashStr(text, text_end - text);
+    key = ImHashData(&wrapWidth, sizeof(wrapWidth), key);
+    key = ImHashData(&font, sizeof(font), key);
+    key = ImHashData(&size, sizeof(size), key);
+
+    auto& cache = GetWrapCache();
+    int frame = ImGui::GetFrameCount();
+    //drop layouts of texts and widths which went away
+    if (frame - cache.lastGC >= WrapCache::MAX_AGE) {
+        cache.lastGC = frame;
+        for (auto it = cache.layouts.begin(); it != cache.layouts.end(); ) {
+            if (frame - it->second.lastFrame > WrapCache::MAX_AGE)
+                it = cache.layouts.erase(it);
+            else
+                ++it;
+        }
+    }
+    auto& layout = cache.layouts[key];
+    if (layout.lines.empty() ||
+        layout.wrapWidth != wrapWidth || layout.font != font || layout.size != size ||
+        layout.text.size() != size_t(text_end - text) ||
+        memcmp(layout.text.data(), text, text_end - text))
     {
-        if (fmt[i] == '{') {
-            if (i + 1 == fmt.size())
+        layout.lines.clear();
+        layout.width = 0;
+        layout.text.assign(text, text_end);
+        layout.wrapWidth = wrapWidth;
+        layout.font = font;
+        layout.size = size;
+        //CalcWordWrapPosition doesn't stop at '\n' so wrap each paragraph separately
+        const char* s = text;
+        while (true)
+        {
+            const char* nl = (const char*)memchr(s, '\n', text_end - s);
+            const char* par_end = nl ? nl : text_end;
+            do {
+                const char* eol = font->CalcWordWrapPosition(size, s, par_end, wrapWidth);
+                if (eol == s && s < par_end) {
+                    //not even a single character fits
+                    unsigned int c;
+                    eol = s + ImTextCharFromUtf8(&c, s, par_end);
+                }
+                layout.lines.push_back({ int(s - text), int(eol - text) });
+                layout.width = std::max(layout.width, font->CalcTextSizeA(size, FLT_MAX, 0, s, eol).x);
+                //wrapping skips upcoming blanks
+                s = eol;
+                while (s < par_end && ImCharIsBlankA(*s))
+                    ++s;
+            } while (s < par_end);
+            if (!nl)
                 break;
-            if (fmt[i + 1] == '{') {
-                s += '{';
-                ++i;
-            }
-            else {
-                auto j = fmt.find('}', i + 1);
-                if (j == std::string::npos)
-                    break;
-                if constexpr (std::is_same_v<std::decay_t<A1>, std::string>)
-                    s += arg;
-                else if constexpr (std::is_same_v<std::decay_t<A1>, const char*> ||
-                                    std::is_same_v<std::decay_t<A1>, char*>)
-                    s += arg;
-                else if constexpr (std::is_same_v<std::decay_t<A1>, char>)
-                    s += arg;
-                else
-                    s += std::to_string(arg);
-                return s + FormatFallback(fmt.substr(j + 1), args...);
-            }
+            s = nl + 1;
         }
-        else
-            s += fmt[i];
+        //trailing newline doesn't start a new line, same as CalcTextSize
+        if (layout.lines.size() > 1 && layout.lines.back().first == layout.lines.back().second)
+            layout.lines.pop_back();
     }
-    return s;
+    layout.lastFrame = frame;
+    return layout;
 }
 
-#ifdef IMRAD_WITH_FMT
-template <class... A>
-std::string Format(std::string_view fmt, A&&... args)
+void TextWrapCached(const char* text, const char* text_end)
 {
-    return fmt::format(fmt, std::forward<A>(args)...);
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    if (window->SkipItems)
+        return;
+    if (!text_end)
+        text_end = text + strlen(text);
+    float wrapPosX = window->DC.TextWrapPos;
+    if (wrapPosX < 0 || text == text_end) {
+        ImGui::TextUnformatted(text, text_end);
+        return;
+    }
+    ImVec2 pos(window->DC.CursorPos.x, window->DC.CursorPos.y + window->DC.CurrLineTextBaseOffset);
+    float wrapWidth = ImGui::CalcWrapWidthForPos(window->DC.CursorPos, wrapPosX);
+    const WrapLayout& layout = GetWrapLayout(text, text_end, wrapWidth);
+    float lh = ImGui::GetTextLineHeight();
+    ImRect bb(pos, { pos.x + layout.width, pos.y + layout.lines.size() * lh });
+    ImGui::ItemSize(bb.GetSize(), 0.f);
+    if (!ImGui::ItemAdd(bb, 0))
+        return;
+
+    const ImRect& clip = window->ClipRect;
+    int first = std::max(0, (int)((clip.Min.y - pos.y) / lh));
+    int last = std::min((int)layout.lines.size(), (int)((clip.Max.y - pos.y) / lh) + 1);
+    ImU32 col = ImGui::GetColorU32(ImGuiCol_Text);
+    for (int i = first; i < last; ++i)
+    {
+        const auto& ln = layout.lines[i];
+        window->DrawList->AddText(ImGui::GetFont(), ImGui::GetFontSize(), { pos.x, pos.y + i * lh },
+            col, text + ln.first, text + ln.second);
+    }
 }
 
-#elif __cplusplus >= 202002L && __has_include(<format>)
+//PlotLines is declared in imrad_feed.h
+//min/max pyramid of a sample series
+//level i keeps one (min, max) pair per BLOCK << i samples
+struct PlotLod
+{
+    static constexpr int BLOCK = 32;
+    static constexpr int MAX_AGE = 60; //frames
 
-//only support format_string version for compile time checks
-template <class... A>
-std::string Format(std::format_string<A...> fmt, A&&... args)
+    std::vector<std::vector<ImVec2>> levels;
+    size_t size = 0; //samples covered by levels
+    size_t dirtyBegin = size_t(-1), dirtyEnd = 0;
+    int lastFrame = 0;
+    float first = 0, last = 0; //fingerprint of the covered samples
+
+    //detects data replaced at the same address
+    bool Matches(const float* data) const
+    {
+        return !size ||
+            (!memcmp(&first, data, sizeof(float)) && !memcmp(&last, data + size - 1, sizeof(float)));
+    }
+
+    //min/max of a full block, 4 lanes at a time where SIMD is available
+    //compilers don't vectorize the scalar loop without -ffast-math
+    static ImVec2 BlockRange(const float* p)
+    {
+        float mn[4], mx[4];
+#if defined(IMGUI_ENABLE_SSE)
+        __m128 vmn = _mm_loadu_ps(p), vmx = vmn;
+        for (int j = 4; j < BLOCK; j += 4) {
+            __m128 v = _mm_loadu_ps(p + j);
+            vmn = _mm_min_ps(v, vmn);
+            vmx = _mm_max_ps(v, vmx);
+        }
+        _mm_storeu_ps(mn, vmn);
+        _mm_storeu_ps(mx, vmx);
+#elif defined(__ARM_NEON)
+        float32x4_t vmn = vld1q_f32(p), vmx = vmn;
+        for (int j = 4; j < BLOCK; j += 4) {
+            float32x4_t v = vld1q_f32(p + j);
+            vmn = vminq_f32(v, vmn);
+            vmx = vmaxq_f32(v, vmx);
+        }
+        vst1q_f32(mn, vmn);
+        vst1q_f32(mx, vmx);
+#else
+        for (int l = 0; l < 4; ++l)
+            mn[l] = mx[l] = p[l];
+        for (int j = 4; j < BLOCK; j += 4)
+            for (int l = 0; l < 4; ++l) {
+                mn[l] = p[j + l] < mn[l] ? p[j + l] : mn[l];
+                mx[l] = p[j + l] > mx[l] ? p[j + l] : mx[l];
+            }
+#endif
+        ImVec2 v = { mn[0], mx[0] };
+        for (int l = 1; l < 4; ++l) {
+            v.x = mn[l] < v.x ? mn[l] : v.x;
+            v.y = mx[l] > v.y ? mx[l] : v.y;
+        }
+        return v;
+    }
+
+    //recomputes blocks overlapping samples [b, e)
+    void Update(const float* data, size_t n, size_t b, size_t e)
+    {
+        if (levels.empty())
+            levels.resize(1);
+        size_t lo = b / BLOCK;
+        size_t hi = (e + BLOCK - 1) / BLOCK;
+        auto& l0 = levels[0];
+        l0.resize((n + BLOCK - 1) / BLOCK);
+        for (size_t i = lo; i < hi; ++i)
+        {
+            const float* p = data + i * BLOCK;
+            size_t cnt = std::min<size_t>(BLOCK, n - i * BLOCK);
+            if (cnt == BLOCK) {
+                l0[i] = BlockRange(p);
+                continue;
+            }
+            float mn = p[0], mx = p[0];
+            for (size_t j = 1; j < cnt; ++j) {
+                mn = p[j] < mn ? p[j] : mn;
+                mx = p[j] > mx ? p[j] : mx;
+            }
+            l0[i] = { mn, mx };
+        }
+        for (size_t k = 1; levels[k - 1].size() > 1; ++k)
+        {
+            if (k == levels.size())
+                levels.emplace_back();
+            const auto& prev = levels[k - 1];
+            auto& cur = levels[k];
+            cur.resize((prev.size() + 1) / 2);
+            lo /= 2;
+            hi = (hi + 1) / 2;
+            for (size_t i = lo; i < hi; ++i)
+            {
+                ImVec2 v = prev[2 * i];
+                if (2 * i + 1 < prev.size()) {
+                    v.x = std::min(v.x, prev[2 * i + 1].x);
+                    v.y = std::max(v.y, prev[2 * i + 1].y);
+                }
+                cur[i] = v;
+            }
+        }
+        size = n;
+        first = data[0];
+        last = data[n - 1];
+    }
+
+    //min/max of samples [b, e) rounded to blocks of the given level
+    ImVec2 Range(int level, size_t b, size_t e) const
+    {
+        const auto& lv = levels[level];
+        size_t bs = (size_t)BLOCK << level;
+        size_t lo = b / bs;
+        size_t hi = std::min(lv.size(), (e + bs - 1) / bs);
+        ImVec2 v = lv[lo];
+        for (size_t i = lo + 1; i < hi; ++i) {
+            v.x = std::min(v.x, lv[i].x);
+            v.y = std::max(v.y, lv[i].y);
+        }
+        return v;
+    }
+};
+
+//pyramids are keyed by data pointer, vector reallocation starts from scratch
+inline std::unordered_map<const float*, PlotLod>& GetPlotCache()
 {
-    return std::format(fmt, std::forward<A>(args)...);
+    static std::unordered_map<const float*, PlotLod> cache;
+    return cache;
 }
 
-#else
+void InvalidatePlot(const float* data, size_t b, size_t e)
+{
+    auto& cache = GetPlotCache();
+    auto it = cache.find(data);
+    if (it == cache.end())
+        return;
+    it->second.dirtyBegin = std::min(it->second.dirtyBegin, b);
+    it->second.dirtyEnd = std::max(it->second.dirtyEnd, e);
+}
 
-template <class... A>
-std::string Format(std::string_view fmt, A&&... args)
+void PlotLines(const char* id, const float* data, size_t n, const ImVec2& size_arg,
+    float scaleMin, float scaleMax)
 {
-    return FormatFallback(fmt, std::forward<A>(args)...);
+    ImGuiWindow* window = ImGui::GetCurrentWindow();
+    if (window->SkipItems)
+        return;
+    const ImGuiStyle& style = ImGui::GetStyle();
+    ImVec2 size = ImGui::CalcItemSize(size_arg, ImGui::CalcItemWidth(), ImGui::GetTextLineHeight() * 4 + style.FramePadding.y * 2);
+    ImVec2 pos = window->DC.CursorPos;
+    ImRect bb(pos.x, pos.y, pos.x + size.x, pos.y + size.y);
+    ImGui::ItemSize(bb, style.FramePadding.y);
+    if (!ImGui::ItemAdd(bb, window->GetID(id)))
+        return;
+    ImGui::RenderFrame(bb.Min, bb.Max, ImGui::GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
+
+    auto& cache = GetPlotCache();
+    int frame = ImGui::GetFrameCount();
+    static int lastGC = 0;
+    if (frame - lastGC >= PlotLod::MAX_AGE) {
+        lastGC = frame;
+        for (auto it = cache.begin(); it != cache.end(); ) {
+            if (frame - it->second.lastFrame > PlotLod::MAX_AGE)
+                it = cache.erase(it);
+            else
+                ++it;
+        }
+    }
+    if (!n) {
+        //cleared series starts from scratch when refilled
+        cache.erase(data);
+        return;
+    }
+    PlotLod& lod = cache[data];
+    lod.lastFrame = frame;
+    if (n < lod.size || !lod.Matches(data)) {
+        lod.levels.clear();
+        lod.size = 0;
+    }
+    size_t built = lod.size;
+    if (n > built || lod.levels.empty())
+        lod.Update(data, n, built, n);
+    if (lod.dirtyBegin < lod.dirtyEnd && lod.dirtyBegin < built)
+        lod.Update(data, n, lod.dirtyBegin, std::min(lod.dirtyEnd, built));
+    lod.dirtyBegin = size_t(-1);
+    lod.dirtyEnd = 0;
+
+    if (scaleMin == FLT_MAX || scaleMax == FLT_MAX) {
+        ImVec2 mm = lod.levels.back()[0];
+        if (scaleMin == FLT_MAX)
+            scaleMin = mm.x;
+        if (scaleMax == FLT_MAX)
+            scaleMax = mm.y;
+    }
+    float scale = scaleMax != scaleMin ? 1.f / (scaleMax - scaleMin) : 0.f;
+
+    ImVec2 pad = style.FramePadding;
+    ImRect inner(bb.Min.x + pad.x, bb.Min.y + pad.y, bb.Max.x - pad.x, bb.Max.y - pad.y);
+    int width = std::max(1, (int)inner.GetWidth());
+    auto toY = [&](float v) {
+        return inner.Max.y - ImSaturate((v - scaleMin) * scale) * inner.GetHeight();
+    };
+    static std::vector<ImVec2> pts;
+    pts.clear();
+    double spp = (double)n / width;
+    if (spp <= 2)
+    {
+        //few samples, plot them directly
+        float dx = n > 1 ? inner.GetWidth() / (n - 1) : 0.f;
+        for (size_t i = 0; i < n; ++i)
+            pts.push_back({ inner.Min.x + i * dx, toY(data[i]) });
+    }
+    else
+    {
+        int level = 0;
+        while (level + 1 < (int)lod.levels.size() && ((size_t)PlotLod::BLOCK << (level + 1)) <= spp)
+            ++level;
+        for (int x = 0; x < width; ++x)
+        {
+            size_t b = size_t(x * spp);
+            size_t e = std::max(b + 1, std::min(n, size_t((x + 1) * spp)));
+            ImVec2 mm;
+            if (spp < PlotLod::BLOCK) {
+                mm = { data[b], data[b] };
+                for (size_t i = b + 1; i < e; ++i) {
+                    mm.x = std::min(mm.x, data[i]);
+                    mm.y = std::max(mm.y, data[i]);
+                }
+            }
+            else
+                mm = lod.Range(level, b, e);
+            //envelope column, the polyline zigzags through min and max
+            float px = inner.Min.x + x + 0.5f;
+            pts.push_back({ px, toY(mm.x) });
+            pts.push_back({ px, toY(mm.y) });
+        }
+    }
+    window->DrawList->AddPolyline(pts.data(), (int)pts.size(), ImGui::GetColorU32(ImGuiCol_PlotLines), 0, 1.0f);
 }
-#endif
 
 #if (defined (IMRAD_WITH_GLFW) || defined(ANDROID)) && defined(IMRAD_WITH_STB)
-// Simple helper function to load an image into a OpenGL texture with common settings
-// https://github.com/ocornut/imgui/wiki/Image-Loading-and-Displaying-Examples
-inline Texture LoadTextureFromFile(
-    std::string_view filename,
-    int minFilter = GL_LINEAR,
-    int magFilter = GL_LINEAR,
-    int wrapS = GL_CLAMP_TO_EDGE, // This is required on WebGL for non power-of-two textures
-    int wrapT = GL_CLAMP_TO_EDGE // Same
-) {
+Texture LoadTextureFromFile(std::string_view filename, int minFilter, int magFilter, int wrapS, int wrapT)
+{
     // Load from file
     Texture tex;
     unsigned char* image_data = nullptr;
 #ifdef ANDROID
     unsigned char* buffer;
-    int len = GetAssetData(filename.c_str(), &buffer);
+    int len = GetAssetData(std::string(filename).c_str(), (void**)&buffer);
     image_data = stbi_load_from_memory(buffer, len, &tex.w, &tex.h, NULL, 4);
 #else
     std::string tmp(filename);
@@ -949,8 +1702,6 @@ inline Texture LoadTextureFromFile(
 
     return tex;
 }
-#else
-Texture LoadTextureFromFile(std::string_view filename);
 #endif
 
 inline std::filesystem::path u8path(std::string_view s)
@@ -971,8 +1722,7 @@ inline std::string u8string(const std::filesystem::path& p)
 #endif
 }
 
-//For debugging pruposes
-inline void SaveStyle(std::string_view spath, const ImGuiStyle* src = nullptr, const std::map<std::string, std::string>& extra = {})
+void SaveStyle(std::string_view spath, const ImGuiStyle* src, const std::map<std::string, std::string>& extra)
 {
     const ImGuiStyle* style = src ? src : &ImGui::GetStyle();
     auto stylePath = u8path(spath);
@@ -1034,9 +1784,7 @@ inline void SaveStyle(std::string_view spath, const ImGuiStyle* src = nullptr, c
     }
 }
 
-//This function can be used in your code to load style and fonts from the INI file
-//It is also used by ImRAD when switching themes
-inline void LoadStyle(std::string_view spath, float fontScaling = 1, ImGuiStyle* dst = nullptr, std::map<std::string, ImFont*>* fontMap = nullptr, std::map<std::string, std::string>* extra = nullptr)
+void LoadStyle(std::string_view spath, float fontScaling, ImGuiStyle* dst, std::map<std::string, ImFont*>* fontMap, std::map<std::string, std::string>* extra)
 {
     ImGuiStyle* style = dst ? dst : &ImGui::GetStyle();
     *style = ImGuiStyle();
@@ -1173,8 +1921,7 @@ inline void LoadStyle(std::string_view spath, float fontScaling = 1, ImGuiStyle*
         (*fontMap)[""] = io.Fonts->AddFontDefault();
 }
 
-//This function will be called from the generated code when alternate font is used
-inline ImFont* GetFontByName(std::string_view name)
+ImFont* GetFontByName(std::string_view name)
 {
     if (name == "")
         return ImGui::GetDefaultFont();
@@ -1189,4 +1936,63 @@ inline ImFont* GetFontByName(std::string_view name)
     return nullptr;
 }
 
+#ifdef IMRAD_WITH_PROFILER
+void ShowProfiler(bool* p_open)
+{
+    ImGui::SetNextWindowBgAlpha(0.85f);
+    if (!ImGui::Begin("ImRAD Profiler", p_open, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoFocusOnAppearing))
+    {
+        ImGui::End();
+        return;
+    }
+    auto& reg = GetProfileRegistry();
+    int n = std::min(reg.count.load(std::memory_order_relaxed), ProfileRegistry::MAX_ENTRIES);
+    if (ImGui::BeginTable("##prof", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV))
+    {
+        ImGui::TableSetupColumn("name");
+        ImGui::TableSetupColumn("last ms");
+        ImGui::TableSetupColumn("avg ms");
+        ImGui::TableSetupColumn("max ms");
+        ImGui::TableHeadersRow();
+        for (int i = 0; i < n; ++i)
+        {
+            const auto& e = reg.entries[i];
+            const char* name = e.name.load(std::memory_order_acquire);
+            int head = e.head.load(std::memory_order_acquire);
+            if (!name || !head)
+                continue;
+            int cnt = std::min(head, ProfileEntry::HISTORY);
+            int64_t sum = 0, max = 0;
+            for (int j = 0; j < cnt; ++j) {
+                int64_t v = e.history[(head - 1 - j) % ProfileEntry::HISTORY].load(std::memory_order_relaxed);
+                sum += v;
+                max = std::max(max, v);
+            }
+            int64_t last = e.history[(head - 1) % ProfileEntry::HISTORY].load(std::memory_order_relaxed);
+            //containers are named Window/Type and nest under their window
+            int level = 0;
+            for (const char* c = name; *c; ++c)
+                level += *c == '/';
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            if (level)
+                ImGui::Indent(level * ImGui::GetStyle().IndentSpacing);
+            ImGui::TextUnformatted(level ? strrchr(name, '/') + 1 : name);
+            if (level)
+                ImGui::Unindent(level * ImGui::GetStyle().IndentSpacing);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", last / 1e6);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", sum / 1e6 / cnt);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", max / 1e6);
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
 }
+#endif
+
+}
+
+#endif
@@ -0,0 +1,188 @@
+#pragma once
+//async event handlers: TaskScheduler, Task, RunAsync, Busy
+//generated code includes it for windows with async event handlers
+#include "imrad.h"
+
+#if __cplusplus >= 202002L && __has_include(<coroutine>)
+#include <coroutine>
+#include <optional>
+#include <functional>
+#include <exception>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+
+namespace ImRad {
+
+//runs blocking jobs on worker threads and resumes awaiting coroutines
+//on the UI thread right after next NewFrame
+class TaskScheduler
+{
+public:
+    ~TaskScheduler()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        cv.notify_all();
+        for (auto& th : threads)
+            th.join();
+    }
+
+    //UI thread
+    void Run(std::function<void()> job)
+    {
+        ImGuiContext* ctx = ImGui::GetCurrentContext();
+        if (hookCtx != ctx) {
+            hookCtx = ctx;
+            ImGuiContextHook hook;
+            hook.Type = ImGuiContextHookType_NewFramePost;
+            hook.Callback = [](ImGuiContext*, ImGuiContextHook* h) {
+                ((TaskScheduler*)h->UserData)->ResumeAll();
+            };
+            hook.UserData = this;
+            ImGui::AddContextHook(ctx, &hook);
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (threads.empty()) {
+            unsigned n = std::max(2u, std::thread::hardware_concurrency() / 2);
+            for (unsigned i = 0; i < n; ++i)
+                threads.emplace_back([this] { WorkerLoop(); });
+        }
+        jobs.push_back(std::move(job));
+        cv.notify_one();
+    }
+    //any thread
+    void Post(std::coroutine_handle<> h)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ready.push_back(h);
+    }
+    //UI thread, called from the NewFrame hook
+    void ResumeAll()
+    {
+        std::vector<std::coroutine_handle<>> tmp;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tmp.swap(ready);
+        }
+        for (auto h : tmp)
+            h.resume();
+    }
+
+    std::atomic<int> pending = 0; //running Tasks
+
+private:
+    void WorkerLoop()
+    {
+        while (true)
+        {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [this] { return stop || jobs.size(); });
+                if (stop)
+                    return;
+                job = std::move(jobs.front());
+                jobs.erase(jobs.begin());
+            }
+            job();
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::thread> threads;
+    std::vector<std::function<void()>> jobs;
+    std::vector<std::coroutine_handle<>> ready;
+    ImGuiContext* hookCtx = nullptr;
+    bool stop = false;
+};
+
+inline TaskScheduler& GetTaskScheduler()
+{
+    static TaskScheduler scheduler;
+    return scheduler;
+}
+
+//return type of async event handlers
+//the handler runs on the UI thread until its first co_await and nobody waits for it
+//exceptions must be handled inside, an escaping one terminates the program
+struct Task
+{
+    struct promise_type
+    {
+        promise_type() { ++GetTaskScheduler().pending; }
+        ~promise_type() { --GetTaskScheduler().pending; }
+        Task get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+template <class F>
+struct AsyncAwaiter
+{
+    using R = std::invoke_result_t<F>;
+
+    F fun;
+    std::conditional_t<std::is_void_v<R>, bool, std::optional<R>> result{};
+    std::exception_ptr error;
+
+    bool await_ready() const { return false; }
+    void await_suspend(std::coroutine_handle<> h)
+    {
+        GetTaskScheduler().Run([this, h] {
+            try {
+                if constexpr (std::is_void_v<R>)
+                    fun();
+                else
+                    result.emplace(fun());
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+            GetTaskScheduler().Post(h);
+        });
+    }
+    R await_resume()
+    {
+        if (error)
+            std::rethrow_exception(error);
+        if constexpr (!std::is_void_v<R>)
+            return std::move(*result);
+    }
+};
+
+//co_await ImRad::RunAsync(fun) runs fun on a worker thread and continues
+//on the UI thread before the next frame with fun's result
+template <class F>
+inline AsyncAwaiter<std::decay_t<F>> RunAsync(F&& fun)
+{
+    return { std::forward<F>(fun) };
+}
+
+//sets the flag while the enclosing handler runs, bind it to widget's disabled
+//or visible property
+//auto busy = ImRad::Busy(&loading);
+struct Busy
+{
+    Busy(bool* f) : flag(f) { *flag = true; }
+    ~Busy() { *flag = false; }
+    Busy(const Busy&) = delete;
+    Busy& operator= (const Busy&) = delete;
+
+    bool* flag;
+};
+
+inline bool IsAnyTaskPending()
+{
+    return GetTaskScheduler().pending > 0;
+}
+
+}
+#endif
@@ -0,0 +1,385 @@
+#pragma once
+//paged and sorted table rows: DataSource, DataView, RowOrder
+//generated code includes it for windows with DataView or RowOrder fields
+#include "imrad.h"
+#include <map>
+#include <functional>
+#include <mutex>
+#include <thread> //DataView worker
+#include <condition_variable>
+
+namespace ImRad {
+
+//rows provided on demand e.g. from a database
+//all calls come from a worker thread one at a time
+template <class Row>
+struct DataSource
+{
+    virtual ~DataSource() {}
+    virtual size_t RowCount() = 0;
+    virtual void FetchRows(size_t first, size_t count, std::vector<Row>& rows) = 0;
+    //optional, return false when unsupported
+    virtual bool SetSort(const ImGuiTableSortSpecs* specs) { return false; }
+    virtual bool SetFilter(std::string_view filter) { return false; }
+};
+
+//container-like view of a DataSource which Table and Child can bind to
+//with clipping enabled only pages of visible rows are requested, they are
+//loaded asynchronously and kept in a small LRU cache
+//rows which didn't arrive yet read as default constructed Row
+//sorting, filtering and refreshing are queued to the worker as well so the
+//UI thread never waits for the source
+template <class Row>
+class DataView
+{
+public:
+    static constexpr size_t PAGE_SIZE = 128;
+
+    DataView(size_t maxPages = 64) : maxPages(maxPages) {}
+    DataView(const DataView&) = delete;
+    DataView& operator= (const DataView&) = delete;
+    ~DataView()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        cv.notify_all();
+        if (worker.joinable())
+            worker.join();
+    }
+
+    //waits for a fetch in progress so the previous source can be destroyed after
+    void SetSource(DataSource<Row>* src)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        idle.wait(lock, [this] { return !busy; });
+        source = src;
+        ++generation;
+        pages.clear();
+        requests.clear();
+        count = 0;
+        resetPending = sortPending = filterPending = false;
+        refreshPending = true;
+        Wake();
+    }
+    //call when the underlying data changed
+    //cached rows are replaced in the first frame after the worker gets the new row count
+    void Refresh()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        refreshPending = true;
+        Wake();
+    }
+    void Sort(const ImGuiTableSortSpecs* specs)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        sortSpecs.clear();
+        if (specs)
+            sortSpecs.assign(specs->Specs, specs->Specs + specs->SpecsCount);
+        sortPending = true;
+        Wake();
+    }
+    void Filter(std::string_view filter)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        filterText = filter;
+        filterPending = true;
+        Wake();
+    }
+
+    size_t size()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        NewFrame();
+        return count;
+    }
+    bool IsLoaded(size_t i)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        NewFrame();
+        auto it = pages.find(i / PAGE_SIZE);
+        return it != pages.end() && it->second.ready;
+    }
+    const Row& operator[] (size_t i)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        NewFrame();
+        size_t pi = i / PAGE_SIZE;
+        Page& page = Touch(pi);
+        //prefetch neighbor pages for scrolling
+        if (pi + 1 < (count + PAGE_SIZE - 1) / PAGE_SIZE)
+            Touch(pi + 1);
+        if (pi)
+            Touch(pi - 1);
+        if (!page.ready || i % PAGE_SIZE >= page.rows.size())
+            return empty;
+        return page.rows[i % PAGE_SIZE];
+    }
+
+private:
+    struct Page
+    {
+        std::vector<Row> rows;
+        int lastFrame = 0;
+        bool ready = false;
+    };
+
+    void Wake()
+    {
+        if (!worker.joinable())
+            worker = std::thread([this] { WorkerLoop(); });
+        cv.notify_all();
+    }
+    //returned rows are referenced by the UI until the end of the frame so pages
+    //are only dropped here, at the first access of the next frame
+    void NewFrame()
+    {
+        int frame = ImGui::GetFrameCount();
+        if (frame == lastFrame)
+            return;
+        lastFrame = frame;
+        if (resetPending) {
+            resetPending = false;
+            pages.clear();
+            requests.clear();
+            count = resetCount;
+        }
+        DropStaleRequests(frame);
+    }
+    Page& Touch(size_t pi)
+    {
+        auto it = pages.find(pi);
+        if (it == pages.end()) {
+            Evict();
+            it = pages.emplace(pi, Page()).first;
+            requests.push_back(pi);
+            Wake();
+        }
+        it->second.lastFrame = ImGui::GetFrameCount();
+        return it->second;
+    }
+    //pages scrolled out of view before their turn came are not fetched at all
+    void DropStaleRequests(int frame)
+    {
+        for (size_t k = 0; k < requests.size(); )
+        {
+            auto it = pages.find(requests[k]);
+            if (it == pages.end() || it->second.lastFrame < frame - 1) {
+                if (it != pages.end())
+                    pages.erase(it);
+                requests.erase(requests.begin() + k);
+            }
+            else
+                ++k;
+        }
+    }
+    //pending pages can go too, a fetch in progress is dropped when it returns
+    void Evict()
+    {
+        int frame = ImGui::GetFrameCount();
+        while (pages.size() >= maxPages)
+        {
+            auto lru = pages.end();
+            for (auto it = pages.begin(); it != pages.end(); ++it)
+                if (it->second.lastFrame != frame &&
+                    (lru == pages.end() || it->second.lastFrame < lru->second.lastFrame))
+                    lru = it;
+            if (lru == pages.end())
+                break;
+            if (!lru->second.ready) {
+                auto rit = std::find(requests.begin(), requests.end(), lru->first);
+                if (rit != requests.end())
+                    requests.erase(rit);
+            }
+            pages.erase(lru);
+        }
+    }
+    void WorkerLoop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            cv.wait(lock, [this] {
+                return stop || refreshPending || sortPending || filterPending ||
+                    (requests.size() && !resetPending);
+                });
+            if (stop)
+                return;
+            busy = true;
+            DataSource<Row>* src = source;
+            if (refreshPending || sortPending || filterPending)
+            {
+                //source state changes go before fetches which would be dropped anyway
+                bool refresh = refreshPending;
+                bool sort = sortPending;
+                bool filt = filterPending;
+                std::vector<ImGuiTableColumnSortSpecs> specs;
+                std::string text;
+                specs.swap(sortSpecs);
+                text.swap(filterText);
+                refreshPending = sortPending = filterPending = false;
+                lock.unlock();
+                size_t n = 0;
+                if (src)
+                {
+                    if (sort) {
+                        ImGuiTableSortSpecs ss;
+                        ss.Specs = specs.data();
+                        ss.SpecsCount = (int)specs.size();
+                        ss.SpecsDirty = true;
+                        refresh |= src->SetSort(&ss);
+                    }
+                    if (filt)
+                        refresh |= src->SetFilter(text);
+                    if (refresh)
+                        n = src->RowCount();
+                }
+                lock.lock();
+                if (refresh) {
+                    //rows fetched before are stale, UI thread drops them
+                    //in NewFrame, until then fetches are put on hold
+                    ++generation;
+                    resetPending = true;
+                    resetCount = n;
+                }
+            }
+            else
+            {
+                //most recent requests are most likely visible
+                size_t pi = requests.back();
+                requests.pop_back();
+                auto it = pages.find(pi);
+                if (it != pages.end() && !it->second.ready && src)
+                {
+                    unsigned gen = generation;
+                    size_t first = pi * PAGE_SIZE;
+                    size_t n = std::min(PAGE_SIZE, count > first ? count - first : 0);
+                    lock.unlock();
+                    std::vector<Row> rows;
+                    src->FetchRows(first, n, rows);
+                    lock.lock();
+                    it = pages.find(pi);
+                    if (gen == generation && it != pages.end()) {
+                        it->second.rows = std::move(rows);
+                        it->second.ready = true;
+                    }
+                }
+            }
+            busy = false;
+            idle.notify_all();
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv, idle;
+    std::thread worker;
+    std::map<size_t, Page> pages;
+    std::vector<size_t> requests;
+    DataSource<Row>* source = nullptr;
+    size_t maxPages;
+    size_t count = 0;
+    unsigned generation = 0;
+    int lastFrame = -1;
+    bool resetPending = false;
+    size_t resetCount = 0;
+    bool refreshPending = false;
+    bool sortPending = false;
+    bool filterPending = false;
+    std::vector<ImGuiTableColumnSortSpecs> sortSpecs;
+    std::string filterText;
+    bool busy = false;
+    bool stop = false;
+    Row empty{};
+};
+
+//sorted and filtered row permutation of a Table
+//it is rebuilt only when sort specs, filter text, row count change or after
+//Invalidate() so steady frames only iterate the cached indexes
+class RowOrder
+{
+public:
+    using CompareFunc = std::function<int(const CompareRowsArgs&)>;
+    using FilterFunc = std::function<bool(const FilterRowArgs&)>;
+
+    struct clip_range
+    {
+        ClipRange clip;
+        const std::vector<int>& rows;
+
+        struct iterator
+        {
+            ClipRange::iterator it;
+            const std::vector<int>* rows;
+
+            int operator* () const { return (*rows)[*it]; }
+            bool operator!= (const iterator& i) const { return it != i.it; }
+            iterator& operator++ () { ++it; return *this; }
+        };
+
+        iterator begin() { return { clip.begin(), &rows }; }
+        iterator end() { return { clip.end(), &rows }; }
+    };
+
+    //call after modifying rows in place
+    void Invalidate() { dirty = true; }
+
+    //call within BeginTable/EndTable before iterating
+    void Update(size_t n, CompareFunc compare, FilterFunc pass, std::string_view filterText = "")
+    {
+        if (filterText != text) {
+            text = filterText;
+            size_t len = std::min(text.size(), sizeof(filter.InputBuf) - 1);
+            memcpy(filter.InputBuf, text.data(), len);
+            filter.InputBuf[len] = '\0';
+            filter.Build();
+            dirty = true;
+        }
+        if (n != count) {
+            count = n;
+            dirty = true;
+        }
+        ImGuiTableSortSpecs* specs = ImGui::TableGetSortSpecs();
+        if (specs && specs->SpecsDirty) {
+            specs->SpecsDirty = false;
+            dirty = true;
+        }
+        if (!dirty)
+            return;
+        dirty = false;
+
+        rows.clear();
+        for (int i = 0; i < (int)n; ++i)
+            if (!pass || pass({ i, filter }))
+                rows.push_back(i);
+        if (!compare || !specs || !specs->SpecsCount)
+            return;
+        std::stable_sort(rows.begin(), rows.end(), [&](int a, int b) {
+            for (int i = 0; i < specs->SpecsCount; ++i) {
+                const auto& spec = specs->Specs[i];
+                int cmp = compare({ a, b, spec.ColumnIndex });
+                if (spec.SortDirection == ImGuiSortDirection_Descending)
+                    cmp = -cmp;
+                if (cmp)
+                    return cmp < 0;
+            }
+            return false;
+            });
+    }
+
+    size_t size() const { return rows.size(); }
+    int operator[] (size_t i) const { return rows[i]; }
+    auto begin() const { return rows.begin(); }
+    auto end() const { return rows.end(); }
+    //iterates visible rows only
+    clip_range Clip() const { return { ClipRange(rows.size()), rows }; }
+
+private:
+    std::vector<int> rows;
+    ImGuiTextFilter filter;
+    std::string text;
+    size_t count = size_t(-1);
+    bool dirty = true;
+};
+
+}
@@ -0,0 +1,285 @@
+#pragma once
+//live data helpers: LogBuffer/LogView, PlotLines, Channel, Latest
+//generated code includes it for windows using LogView or Plot widgets
+//PlotLines is compiled in the IMRAD_IMPLEMENTATION part of imrad.h
+#include "imrad.h"
+#include <mutex> //LogBuffer
+#include <atomic> //Channel, Latest
+
+namespace ImRad {
+
+//append-only log with fixed memory footprint
+//characters and line offsets live in ring buffers, oldest lines are dropped
+//Append can be called from any thread
+class LogBuffer
+{
+public:
+    LogBuffer(size_t maxBytes = 1 << 20, size_t maxLines = 10000)
+        : data(maxBytes), lines(maxLines)
+    {}
+
+    //splits text on '\n'
+    void Append(std::string_view text)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        while (true)
+        {
+            size_t i = text.find('\n');
+            AppendLine(text.substr(0, i));
+            if (i == std::string_view::npos)
+                break;
+            text.remove_prefix(i + 1);
+        }
+    }
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        first = end = 0;
+        writePos = 0;
+        filtered.clear();
+        filterEnd = 0;
+    }
+    size_t Size()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return size_t(end - first);
+    }
+    //i-th stored line, 0 is the oldest one
+    std::string operator[] (size_t i)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return std::string(GetLine(first + i));
+    }
+
+private:
+    friend void LogView(const char*, LogBuffer&, const ImVec2&, const char*, bool);
+
+    struct Line
+    {
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    void AppendLine(std::string_view s)
+    {
+        //a line never exceeds a quarter of the buffer
+        s = s.substr(0, data.size() / 4);
+        if (!s.empty() && s.back() == '\r')
+            s.remove_suffix(1);
+        if (writePos + s.size() > data.size())
+        {
+            //lines stored after the wrap point are the oldest ones
+            while (first < end && lines[first % lines.size()].offset >= writePos)
+                ++first;
+            writePos = 0;
+        }
+        //remaining lines follow from offset 0 in append order
+        while (first < end)
+        {
+            const Line& ln = lines[first % lines.size()];
+            if (end - first < lines.size() &&
+                (ln.offset >= writePos + s.size() || ln.offset + ln.size <= writePos))
+                break;
+            ++first;
+        }
+        memcpy(data.data() + writePos, s.data(), s.size());
+        lines[end % lines.size()] = { (uint32_t)writePos, (uint32_t)s.size() };
+        ++end;
+        writePos += s.size();
+    }
+
+    std::string_view GetLine(uint64_t i) const
+    {
+        const Line& ln = lines[i % lines.size()];
+        return { data.data() + ln.offset, ln.size };
+    }
+
+    //only lines appended since last call are scanned unless the filter changes
+    void UpdateFilter(const char* filter)
+    {
+        if (filterText != filter) {
+            filterText = filter;
+            filtered.clear();
+            filterEnd = first;
+        }
+        auto it = std::lower_bound(filtered.begin(), filtered.end(), first);
+        filtered.erase(filtered.begin(), it);
+        for (uint64_t i = std::max(filterEnd, first); i < end; ++i)
+            if (GetLine(i).find(filterText) != std::string_view::npos)
+                filtered.push_back(i);
+        filterEnd = end;
+    }
+
+    std::mutex mutex;
+    std::vector<char> data;
+    std::vector<Line> lines;
+    size_t writePos = 0;
+    uint64_t first = 0, end = 0; //sequence numbers of stored lines
+    std::string filterText;
+    std::vector<uint64_t> filtered;
+    uint64_t filterEnd = 0;
+};
+
+//renders only visible lines, keeps scrolled to the bottom while new lines come
+//when autoScroll is set and the view isn't scrolled up by the user
+inline void LogView(const char* id, LogBuffer& log, const ImVec2& size, const char* filter = nullptr, bool autoScroll = true)
+{
+    if (!ImGui::BeginChild(id, size, ImGuiChildFlags_FrameStyle, ImGuiWindowFlags_HorizontalScrollbar)) {
+        ImGui::EndChild();
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(log.mutex);
+        bool filtering = filter && *filter;
+        if (filtering)
+            log.UpdateFilter(filter);
+        int n = filtering ? (int)log.filtered.size() : (int)(log.end - log.first);
+        ImGuiListClipper clipper;
+        clipper.Begin(n);
+        while (clipper.Step())
+        {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+            {
+                auto ln = log.GetLine(filtering ? log.filtered[i] : log.first + i);
+                ImGui::TextUnformatted(ln.data(), ln.data() + ln.size());
+            }
+        }
+        clipper.End();
+    }
+    if (autoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+        ImGui::SetScrollHereY(1.0f);
+    ImGui::EndChild();
+}
+
+//call when samples [b, e) were modified in place, appends and replaced series
+//(changed first or last sample) are detected automatically
+void InvalidatePlot(const float* data, size_t b = 0, size_t e = size_t(-1));
+
+//line plot which decimates large series to a min/max envelope per pixel column
+//so the vertex count depends on the width only
+void PlotLines(const char* id, const float* data, size_t n, const ImVec2& size_arg,
+    float scaleMin = FLT_MAX, float scaleMax = FLT_MAX);
+
+inline void PlotLines(const char* id, const std::vector<float>& data, const ImVec2& size,
+    float scaleMin = FLT_MAX, float scaleMax = FLT_MAX)
+{
+    PlotLines(id, data.data(), data.size(), size, scaleMin, scaleMax);
+}
+
+//bounded lock-free queue for feeding a window from worker threads
+//Push can be called from any number of threads, Pop/Drain from the UI thread only
+template <class T, size_t N = 1024>
+class Channel
+{
+    static_assert(N && !(N & (N - 1)), "Channel capacity must be a power of 2");
+
+public:
+    Channel() : cells(new Cell[N])
+    {
+        for (size_t i = 0; i < N; ++i)
+            cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+    Channel(const Channel&) = delete;
+    Channel& operator= (const Channel&) = delete;
+
+    //returns false when the channel is full
+    bool Push(T value)
+    {
+        size_t pos = tail.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true)
+        {
+            cell = &cells[pos & (N - 1)];
+            size_t seq = cell->seq.load(std::memory_order_acquire);
+            intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+            if (!dif) {
+                if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (dif < 0)
+                return false;
+            else
+                pos = tail.load(std::memory_order_relaxed);
+        }
+        cell->value = std::move(value);
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+    bool Pop(T& value)
+    {
+        Cell& cell = cells[head & (N - 1)];
+        if (cell.seq.load(std::memory_order_acquire) != head + 1)
+            return false;
+        value = std::move(cell.value);
+        cell.seq.store(head + N, std::memory_order_release);
+        ++head;
+        return true;
+    }
+    //calls fun for every queued item, typically once per frame before Draw
+    template <class F>
+    int Drain(F&& fun)
+    {
+        int n = 0;
+        T value;
+        while (Pop(value)) {
+            fun(std::move(value));
+            ++n;
+        }
+        return n;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> seq;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    alignas(64) std::atomic<size_t> tail = 0;
+    alignas(64) size_t head = 0;
+};
+
+//triple buffer holding the latest value published by a worker thread
+//Get returns the same snapshot during the whole frame so widgets bound
+//to its fields stay consistent without locking
+template <class T>
+class Latest
+{
+public:
+    //producer side, single thread
+    T& Back() { return buf[back]; }
+    void Publish()
+    {
+        back = middle.exchange(back | DIRTY, std::memory_order_acq_rel) & INDEX;
+    }
+    void Publish(T value)
+    {
+        buf[back] = std::move(value);
+        Publish();
+    }
+
+    //UI thread, picks up a new value at most once per frame
+    const T& Get()
+    {
+        int fc = ImGui::GetFrameCount();
+        if (fc != frame) {
+            frame = fc;
+            if (middle.load(std::memory_order_relaxed) & DIRTY)
+                front = middle.exchange(front, std::memory_order_acq_rel) & INDEX;
+        }
+        return buf[front];
+    }
+
+private:
+    static constexpr int INDEX = 3;
+    static constexpr int DIRTY = 4;
+
+    T buf[3] = {};
+    int back = 0;
+    int front = 1;
+    int frame = -1;
+    std::atomic<int> middle = 2;
+};
+
+}
@@ -258,7 +258,10 @@ Table::Properties()
         { "behavior.scrollFreeze.x##table", &scrollFreeze_x },
         { "behavior.scrollFreeze.y##table", &scrollFreeze_y },
         { "behavior.scrollWhenDragging", &scrollWhenDragging },
-        { "bindings.rowIndex##1", &itemCount.index }
+        { "behavior.clipRows##table", &itemCount.clip },
+        { "bindings.rowIndex##1", &itemCount.index },
+        { "bindings.rowOrder##table", &rowOrder },
+        { "bindings.filterText##table", &filterText },
         });
     return props;
 }
@@ -379,8 +382,9 @@ bool Table::PropertyUI(int i, UIContext& ctx)
             changed = true;
             tableCols.ctx = &ctx;
             tableCols.columns = columnData;
-            tableCols.OpenPopup([this](ImRad::ModalResult mr) {
+            tableCols.OpenPopup([this, &ctx](ImRad::ModalResult mr) {
                 columnData = tableCols.columns;
+                *ctx.modified = true;
                 });
         }
         ImGui::PopFont();
@@ -439,6 +443,15 @@ bool Table::PropertyUI(int i, UIContext& ctx)
         changed = InputDirectVal(&scrollWhenDragging, 0, ctx);
         break;
     case 21:
+        ImGui::BeginDisabled(itemCount.empty());
+        ImGui::Text("clipRows");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        fl = itemCount.clip != Defaults().itemCount.clip ? InputDirectVal_Modified : 0;
+        changed = InputDirectVal(&itemCount.clip, fl, ctx);
+        ImGui::EndDisabled();
+        break;
+    case 22:
         ImGui::BeginDisabled(itemCount.empty());
         ImGui::Text("rowIndex");
         ImGui::TableNextColumn();
@@ -446,8 +459,24 @@ bool Table::PropertyUI(int i, UIContext& ctx)
         changed = InputFieldRef(&itemCount.index, true, ctx);
         ImGui::EndDisabled();
         break;
+    case 23:
+        ImGui::BeginDisabled(itemCount.empty());
+        ImGui::Text("rowOrder");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        changed = InputFieldRef(&rowOrder, "ImRad::RowOrder", true, ctx);
+        ImGui::EndDisabled();
+        break;
+    case 24:
+        ImGui::BeginDisabled(rowOrder.empty());
+        ImGui::Text("filterText");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        changed = InputFieldRef(&filterText, true, ctx);
+        ImGui::EndDisabled();
+        break;
     default:
-        return Widget::PropertyUI(i - 22, ctx);
+        return Widget::PropertyUI(i - 25, ctx);
     }
     return changed;
 }
@@ -460,6 +489,8 @@ Table::Events()
         { "table.setup", &onSetup },
         { "table.beginRow", &onBeginRow },
         { "table.endRow", &onEndRow },
+        { "table.compareRows", &onCompareRows },
+        { "table.filterRow", &onFilterRow },
         });
     return props;
 }
@@ -491,8 +522,24 @@ bool Table::EventUI(int i, UIContext& ctx)
         changed = InputEvent(GetTypeName() + "_EndRow", &onEndRow, 0, ctx);
         ImGui::EndDisabled();
         break;
+    case 3:
+        ImGui::BeginDisabled(rowOrder.empty());
+        ImGui::Text("CompareRows");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-1);
+        changed = InputEvent(GetTypeName() + "_CompareRows", &onCompareRows, 0, ctx);
+        ImGui::EndDisabled();
+        break;
+    case 4:
+        ImGui::BeginDisabled(rowOrder.empty());
+        ImGui::Text("FilterRow");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-1);
+        changed = InputEvent(GetTypeName() + "_FilterRow", &onFilterRow, 0, ctx);
+        ImGui::EndDisabled();
+        break;
     default:
-        return Widget::EventUI(i - 3, ctx);
+        return Widget::EventUI(i - 5, ctx);
     }
     return changed;
 }
@@ -553,7 +600,7 @@ void Table::DoExport(std::ostream& os, UIContext& ctx)
             fl += cd.sizingPolicy.to_arg() + " | ";
         if (cd.flags)
             fl += cd.flags.to_arg() + " | ";
-        if (!cd.visible.empty())
+        if (!cd.visible.empty() && !(cd.visible.has_value() && cd.visible.value()))
             fl += "(" + cd.visible.to_arg() + " ? 0 : ImGuiTableColumnFlags_Disabled) | ";
         if (fl != "")
             fl.resize(fl.size() - 3);
@@ -592,10 +639,34 @@ void Table::DoExport(std::ostream& os, UIContext& ctx)
     }
     if (!itemCount.empty())
     {
-        os << "\n" << ctx.ind << itemCount.to_arg(ctx.codeGen->FOR_VAR_NAME) << "\n" << ctx.ind << "{\n";
+        if (itemCount.clip && !itemCount.index.empty())
+            PushError(ctx, "clipRows requires empty rowIndex");
+        if (itemCount.clip && !rowFilter.empty())
+            PushError(ctx, "clipRows can't be combined with rowFilter");
+        if (!rowOrder.empty())
+        {
+            if (!itemCount.index.empty())
+                PushError(ctx, "rowOrder requires empty rowIndex");
+            os << "\n" << ctx.ind << rowOrder.to_arg() << ".Update(" << itemCount.limit.to_arg() << ", ";
+            if (!onCompareRows.empty())
+                os << "IMRAD_ROW_EVENT(" << onCompareRows.to_arg() << "), ";
+            else
+                os << "nullptr, ";
+            if (!onFilterRow.empty())
+                os << "IMRAD_ROW_EVENT(" << onFilterRow.to_arg() << ")";
+            else
+                os << "nullptr";
+            if (!filterText.empty())
+                os << ", " << filterText.to_arg();
+            os << ");\n";
+            os << ctx.ind << "for (int " << ctx.codeGen->FOR_VAR_NAME << " : " << rowOrder.to_arg()
+                << (itemCount.clip ? ".Clip()" : "") << ")\n" << ctx.ind << "{\n";
+        }
+        else
+            os << "\n" << ctx.ind << itemCount.to_arg(ctx.codeGen->FOR_VAR_NAME) << "\n" << ctx.ind << "{\n";
         ctx.ind_up();
 
-        bool hasCurItem = stx::count(UsedFieldVars(), ctx.codeGen->CUR_ITEM_VAR_NAME);
+        bool hasCurItem = UsesFieldVar(ctx.codeGen->CUR_ITEM_VAR_NAME);
         if (hasCurItem)
         {
             std::string idx = itemCount.index_name_or(ctx.codeGen->FOR_VAR_NAME);
@@ -779,9 +850,26 @@ void Table::DoImport(const cpp::stmt_iterator& sit, UIContext& ctx)
         if (sit->params.size() >= 2)
             rowHeight.set_from_arg(sit->params[1]);
     }
+    else if (sit->kind == cpp::CallExpr && sit->level == ctx.importLevel + 1 &&
+        sit->callee.size() > 7 && !sit->callee.compare(sit->callee.size() - 7, 7, ".Update") &&
+        sit->params.size() >= 3)
+    {
+        rowOrder.set_from_arg(sit->callee.substr(0, sit->callee.size() - 7));
+        itemCount.limit.set_from_arg(sit->params[0]);
+        const std::string EV = "IMRAD_ROW_EVENT(";
+        if (!sit->params[1].compare(0, EV.size(), EV))
+            onCompareRows.set_from_arg(sit->params[1].substr(EV.size(), sit->params[1].size() - EV.size() - 1));
+        if (!sit->params[2].compare(0, EV.size(), EV))
+            onFilterRow.set_from_arg(sit->params[2].substr(EV.size(), sit->params[2].size() - EV.size() - 1));
+        if (sit->params.size() >= 4)
+            filterText.set_from_arg(sit->params[3]);
+    }
     else if (sit->kind == cpp::ForBlock)
     {
-        itemCount.set_from_arg(sit->line);
+        if (!rowOrder.empty())
+            itemCount.clip = sit->line.size() > 8 && !sit->line.compare(sit->line.size() - 8, 8, ".Clip())");
+        else
+            itemCount.set_from_arg(sit->line);
     }
     else if (sit->kind == cpp::CallExpr && sit->level == ctx.importLevel + 1 &&
         columnData.size() &&
@@ -959,7 +1047,11 @@ void Child::DoExport(std::ostream& os, UIContext& ctx)
     if (!style_bg.empty())
         os << ctx.ind << "ImGui::PushStyleColor(ImGuiCol_ChildBg, " << style_bg.to_arg() << ");\n";
 
-    os << ctx.ind << "ImGui::BeginChild(\"child" << ctx.varCounter << "\", ";
+    //direct children of a window with constexpr ID get one too
+    if (ctx.idSeed != "" && ctx.parents.size() == 2)
+        os << ctx.ind << "ImGui::BeginChild(IMRAD_ID(\"child" << ctx.varCounter << "\", " << ctx.idSeed << "), ";
+    else
+        os << ctx.ind << "ImGui::BeginChild(\"child" << ctx.varCounter << "\", ";
     if (szvar != "")
         os << szvar << ", ";
     else {
@@ -987,10 +1079,14 @@ void Child::DoExport(std::ostream& os, UIContext& ctx)
 
     if (!itemCount.empty())
     {
+        if (itemCount.clip && !itemCount.index.empty())
+            PushError(ctx, "clipItems requires empty itemIndex");
+        if (itemCount.clip && hasColumns)
+            PushError(ctx, "clipItems requires single column");
         os << ctx.ind << itemCount.to_arg(ctx.codeGen->FOR_VAR_NAME) << "\n" << ctx.ind << "{\n";
         ctx.ind_up();
 
-        bool hasCurItem = stx::count(UsedFieldVars(), ctx.codeGen->CUR_ITEM_VAR_NAME);
+        bool hasCurItem = UsesFieldVar(ctx.codeGen->CUR_ITEM_VAR_NAME);
         if (hasCurItem)
         {
             std::string idx = itemCount.index_name_or(ctx.codeGen->FOR_VAR_NAME);
@@ -1004,8 +1100,20 @@ void Child::DoExport(std::ostream& os, UIContext& ctx)
 
     os << ctx.ind << "/// @separator\n\n";
 
-    for (auto& child : child_iterator(children, false))
-        child->Export(os, ctx);
+    if (cullRows && (!itemCount.empty() || hasColumns))
+        PushError(ctx, "cullRows requires single column and no itemCount");
+    if (cullRows && itemCount.empty() && !hasColumns)
+    {
+        std::vector<Widget*> items;
+        for (auto& child : child_iterator(children, false))
+            items.push_back(child.get());
+        ExportCulledChildren(os, ctx, items);
+    }
+    else
+    {
+        for (auto& child : child_iterator(children, false))
+            child->Export(os, ctx);
+    }
 
     os << ctx.ind << "/// @separator\n";
 
@@ -1141,6 +1249,8 @@ Child::Properties()
         { "behavior.column_count##child", &columnCount },
         { "behavior.item_count##child", &itemCount.limit },
         { "behavior.scrollWhenDragging", &scrollWhenDragging },
+        { "behavior.clipItems##child", &itemCount.clip },
+        { "behavior.cullRows##child", &cullRows },
         { "bindings.itemIndex##1", &itemCount.index },
         });
     return props;
@@ -1277,6 +1387,24 @@ bool Child::PropertyUI(int i, UIContext& ctx)
         changed = InputDirectVal(&scrollWhenDragging, fl, ctx);
         break;
     case 16:
+        ImGui::BeginDisabled(itemCount.empty());
+        ImGui::Text("clipItems");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        fl = itemCount.clip != Defaults().itemCount.clip ? InputDirectVal_Modified : 0;
+        changed = InputDirectVal(&itemCount.clip, fl, ctx);
+        ImGui::EndDisabled();
+        break;
+    case 17:
+        ImGui::BeginDisabled(!itemCount.empty());
+        ImGui::Text("cullRows");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        fl = cullRows != Defaults().cullRows ? InputDirectVal_Modified : 0;
+        changed = InputDirectVal(&cullRows, fl, ctx);
+        ImGui::EndDisabled();
+        break;
+    case 18:
         ImGui::BeginDisabled(itemCount.empty());
         ImGui::Text("itemIndex");
         ImGui::TableNextColumn();
@@ -1285,7 +1413,7 @@ bool Child::PropertyUI(int i, UIContext& ctx)
         ImGui::EndDisabled();
         break;
     default:
-        return Widget::PropertyUI(i - 17, ctx);
+        return Widget::PropertyUI(i - 19, ctx);
     }
     return changed;
 }
@@ -2039,7 +2167,7 @@ void TabBar::DoExport(std::ostream& os, UIContext& ctx)
         os << ctx.ind << "{\n";
         ctx.ind_up();
 
-        bool hasCurItem = stx::count(UsedFieldVars(), ctx.codeGen->CUR_ITEM_VAR_NAME);
+        bool hasCurItem = UsesFieldVar(ctx.codeGen->CUR_ITEM_VAR_NAME);
         if (hasCurItem)
         {
             std::string idx = itemCount.index_name_or(ctx.codeGen->FOR_VAR_NAME);
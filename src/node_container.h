@@ -27,6 +27,8 @@ struct Table : Widget
     direct_val<int> scrollFreeze_x = 0;
     direct_val<int> scrollFreeze_y = 0;
     direct_val<bool> scrollWhenDragging = false;
+    field_ref<void> rowOrder;
+    field_ref<std::string> filterText;
     direct_val<pzdimension2_t> style_cellPadding;
     bindable<color_t> style_headerBg;
     bindable<color_t> style_rowBg;
@@ -37,6 +39,8 @@ struct Table : Widget
     event<> onBeginRow;
     event<> onEndRow;
     event<> onSetup;
+    event<int(const ImRad::CompareRowsArgs&)> onCompareRows;
+    event<bool(const ImRad::FilterRowArgs&)> onFilterRow;
 
     Table(UIContext&);
     auto Clone(UIContext& ctx)->std::unique_ptr<Widget>;
@@ -48,6 +52,7 @@ struct Table : Widget
     bool EventUI(int i, UIContext& ctx);
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
+    std::string GetTypeName() { return "Table"; }
     const char* GetIcon() const { return ICON_FA_TABLE_CELLS_LARGE; }
     const Table& Defaults() { static Table var(UIContext::Defaults()); return var; }
     int ColumnCount(UIContext& ctx) { return (int)columnData.size(); }
@@ -60,6 +65,7 @@ struct Child : Widget
     bindable<int> columnCount = 1;
     direct_val<bool> columnBorder = true;
     direct_val<bool> scrollWhenDragging = false;
+    direct_val<bool> cullRows = false;
     direct_val<pzdimension2_t> style_padding;
     direct_val<pzdimension2_t> style_spacing;
     direct_val<bool> style_outerPadding = true;
@@ -75,6 +81,7 @@ struct Child : Widget
     bool PropertyUI(int i, UIContext& ctx);
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
+    std::string GetTypeName() { return "Child"; }
     const char* GetIcon() const { return ICON_FA_SQUARE_FULL; }
     void CalcSizeEx(ImVec2 p1, UIContext& ctx);
     const Child& Defaults() { static Child var(UIContext::Defaults()); return var; }
@@ -99,6 +106,7 @@ struct CollapsingHeader : Widget
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     void CalcSizeEx(ImVec2 p1, UIContext& ctx);
+    std::string GetTypeName() { return "CollapsingHeader"; }
     const char* GetIcon() const { return ICON_FA_ARROW_DOWN_WIDE_SHORT; }
     const CollapsingHeader& Defaults() { static CollapsingHeader var(UIContext::Defaults()); return var; }
 };
@@ -124,6 +132,7 @@ struct TabBar : Widget
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     void CalcSizeEx(ImVec2 p1, UIContext& ctx);
+    std::string GetTypeName() { return "TabBar"; }
     const char* GetIcon() const { return ICON_FA_FOLDER_CLOSED; }
     const TabBar& Defaults() { static TabBar var(UIContext::Defaults()); return var; }
 };
@@ -146,6 +155,7 @@ struct TabItem : Widget
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     void CalcSizeEx(ImVec2 p1, UIContext& ctx);
+    std::string GetTypeName() { return "TabItem"; }
     const char* GetIcon() const { return ICON_FA_FOLDER; }
     const TabItem& Defaults() { static TabItem var(UIContext::Defaults()); return var; }
 };
@@ -166,6 +176,7 @@ struct TreeNode : Widget
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     void CalcSizeEx(ImVec2 p1, UIContext& ctx);
+    std::string GetTypeName() { return "TreeNode"; }
     const char* GetIcon() const { return ICON_FA_SITEMAP; }
     const TreeNode& Defaults() { static TreeNode var(UIContext::Defaults()); return var; }
 };
@@ -183,6 +194,7 @@ struct MenuBar : Widget
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     void CalcSizeEx(ImVec2 p1, UIContext& ctx);
+    std::string GetTypeName() { return "MenuBar"; }
     const char* GetIcon() const { return ICON_FA_ELLIPSIS; }
     const MenuBar& Defaults() { static MenuBar var(UIContext::Defaults()); return var; }
 };
@@ -206,6 +218,7 @@ struct ContextMenu : Widget
     void ExportAllShortcuts(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     void CalcSizeEx(ImVec2 p1, UIContext& ctx);
+    std::string GetTypeName() { return "ContextMenu"; }
     const char* GetIcon() const { return ICON_FA_MESSAGE; }
     const ContextMenu& Defaults() { static ContextMenu var(UIContext::Defaults()); return var; }
 };
@@ -233,6 +246,7 @@ struct MenuIt : Widget
     void ExportAllShortcuts(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     void CalcSizeEx(ImVec2 p1, UIContext& ctx);
+    std::string GetTypeName() { return "MenuIt"; }
     const char* GetIcon() const { return ICON_FA_BARS; }
     const MenuIt& Defaults() { static MenuIt var(UIContext::Defaults()); return var; }
 };
@@ -254,6 +268,7 @@ struct Splitter : Widget
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     //void CalcSizeEx(ImVec2 p1, UIContext& ctx);
+    std::string GetTypeName() { return "Splitter"; }
     const char* GetIcon() const { return ICON_FA_TABLE_COLUMNS; }
     const Splitter& Defaults() { static Splitter var(UIContext::Defaults()); return var; }
 };
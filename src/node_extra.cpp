@@ -589,8 +589,9 @@ bool DockNode::PropertyUI(int i, UIContext& ctx)
            comboDlg.title = "Window Names";
            comboDlg.value = labels;
            comboDlg.font = nullptr;
-           comboDlg.OpenPopup([this](ImRad::ModalResult) {
+           comboDlg.OpenPopup([this, &ctx](ImRad::ModalResult) {
                *labels.access() = Trim(comboDlg.value);
+               *ctx.modified = true;
                });
        }
        ImGui::PopFont();
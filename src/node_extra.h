@@ -17,6 +17,7 @@ struct DockSpace : Widget
     bool PropertyUI(int i, UIContext& ctx);
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
+    std::string GetTypeName() { return "DockSpace"; }
     const char* GetIcon() const { return ICON_FA_TABLE; }
     const DockSpace& Defaults() { static DockSpace var(UIContext::Defaults()); return var; }
 };
@@ -43,6 +44,7 @@ struct DockNode : Widget
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     void ExportHelp(std::ostream& os, UIContext& ctx);
+    std::string GetTypeName() { return "DockNode"; }
     const char* GetIcon() const { return "N"; }
     const DockNode& Defaults() { static DockNode var(UIContext::Defaults()); return var; }
 };
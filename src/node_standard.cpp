@@ -7,10 +7,12 @@
 #include "binding_eval.h"
 #include "ui_message_box.h"
 #include "ui_combo_dlg.h"
+#include "imrad_feed.h" //PlotLines
 #include <misc/cpp/imgui_stdlib.h>
 #include <nfd.h>
 #include <algorithm>
 #include <array>
+#include <cmath>
 
 const std::string TMP_LAST_ITEM_VAR = "tmpLastItem";
 
@@ -59,6 +61,23 @@ std::string ParseShortcutOld(const std::string& line)
     return sh;
 }
 
+//compile-time ID of a widget placed directly in a window with known ID
+//returns empty string when the label isn't a literal
+std::string HashedId(const std::string& labelArg, const UIContext& ctx)
+{
+    if (ctx.idSeed == "" || ctx.parents.size() != 2 || labelArg.empty() || labelArg[0] != '"')
+        return "";
+    return "IMRAD_ID(" + labelArg + ", " + ctx.idSeed + ")";
+}
+
+//ImRad:: overloads emitted by HashedId take the ID first
+std::vector<std::string> UnhashedParams(const cpp::stmt_iterator& sit)
+{
+    if (sit->params.empty() || sit->params[0].compare(0, 9, "IMRAD_ID("))
+        return sit->params;
+    return { sit->params.begin() + 1, sit->params.end() };
+}
+
 void TreeNodeProp(const char* name, ImFont* font, const std::string& label, std::function<void()> f)
 {
     ImVec2 pad = ImGui::GetStyle().FramePadding;
@@ -673,20 +692,6 @@ UINode::GetAllChildren()
 }
 
 //this must return exact class id
-std::string UINode::GetTypeName()
-{
-    std::string name = typeid(*this).name();
-    //erase "struct"
-    auto i = name.rfind(' ');
-    if (i != std::string::npos)
-        name.erase(0, i + 1);
-    //erase encoded name length
-    auto it = stx::find_if(name, [](char c) { return isalpha(c); });
-    if (it != name.end())
-        name.erase(0, it - name.begin());
-    return name;
-}
-
 int GetTotalIndex(UINode* parent, UINode* child)
 {
     std::string tname = child->GetTypeName();
@@ -725,6 +730,111 @@ std::string UINode::GetParentIndexes(UIContext& ctx)
     return id;
 }
 
+//consecutive rows are grouped into blocks which are skipped when scrolled
+//out of view. Rows taking part in box layouts, columns or containing free
+//positioned items and focus requests are always submitted
+//widgets which act even when off screen (shortcuts, focus requests, owned popups)
+//have to be submitted every frame so their rows can't be culled
+static bool NeedsEveryFrame(Widget* w)
+{
+    if (w->initialFocus || !w->forceFocus.empty() || !w->contextMenu.empty())
+        return true;
+    if (auto* btn = dynamic_cast<Button*>(w))
+        if (!btn->shortcut.empty() || btn->dropDownMenu != "")
+            return true;
+    if (dynamic_cast<ContextMenu*>(w) || dynamic_cast<MenuIt*>(w))
+        return true;
+    for (const auto& ch : w->children)
+        if (NeedsEveryFrame(ch.get()))
+            return true;
+    return false;
+}
+
+void UINode::ExportCulledChildren(std::ostream& os, UIContext& ctx, const std::vector<Widget*>& items)
+{
+    const size_t BLOCK_ROWS = 8;
+    std::string name = std::string(ctx.codeGen->CULL_NAME) + GetParentIndexes(ctx);
+
+    struct Row {
+        size_t begin, end;
+        bool cull;
+    };
+    std::vector<Row> rows;
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        Widget* w = items[i];
+        bool flow = !w->hasPos && (w->Behavior() & SnapSides);
+        if (rows.empty() || (flow && (!w->sameLine || w->nextColumn)))
+            rows.push_back({ i, i, flow });
+        rows.back().end = i + 1;
+        if (!flow || w->nextColumn || NeedsEveryFrame(w) ||
+            (w->GetLayout(this).flags & (Widget::Layout::HLayout | Widget::Layout::VLayout)))
+            rows.back().cull = false;
+    }
+
+    int block = 0;
+    for (size_t r = 0; r < rows.size(); )
+    {
+        if (!rows[r].cull)
+        {
+            for (size_t i = rows[r].begin; i < rows[r].end; ++i)
+                items[i]->Export(os, ctx);
+            ++r;
+            continue;
+        }
+        size_t e = r;
+        while (e < rows.size() && rows[e].cull && e - r < BLOCK_ROWS)
+            ++e;
+
+        os << ctx.ind << "if (" << name << ".Begin(" << block++ << "))\n";
+        os << ctx.ind << "{\n";
+        ctx.ind_up();
+        for (size_t i = rows[r].begin; i < rows[e - 1].end; ++i)
+            items[i]->Export(os, ctx);
+        os << ctx.ind << name << ".End();\n";
+        ctx.ind_down();
+        os << ctx.ind << "}\n";
+        r = e;
+    }
+
+    if (block)
+        ctx.codeGen->CreateNamedVar(name, "ImRad::CullBlocks", "", CppGen::Var::Impl);
+}
+
+//recognizes lines emitted by ExportCulledChildren so they don't become user code
+//returns 1 for block begin, 2 for other lines
+int UINode::ImportCullCode(std::string_view line, bool& brace)
+{
+    while (line.size() && std::isspace(line.front()))
+        line.remove_prefix(1);
+    while (line.size() && std::isspace(line.back()))
+        line.remove_suffix(1);
+    if (brace && (line == "{" || line == "}")) {
+        brace = false;
+        return 2;
+    }
+    brace = false;
+
+    const std::string_view CULL = CppGen::CULL_NAME;
+    int ret = 2;
+    if (!line.compare(0, 4, "if (")) {
+        line.remove_prefix(4);
+        ret = 1;
+    }
+    if (line.compare(0, CULL.size(), CULL))
+        return 0;
+    line.remove_prefix(CULL.size());
+    while (line.size() && std::isdigit(line.front()))
+        line.remove_prefix(1);
+    if ((ret == 1 && !line.compare(0, 7, ".Begin(") && line.back() == ')') ||
+        (ret == 2 && line == ".End();"))
+    {
+        brace = true;
+        return ret;
+    }
+    return 0;
+}
+
 void UINode::ResetLayout()
 {
     hbox.clear();
@@ -740,7 +850,7 @@ std::vector<std::string> UINode::UsedFieldVars()
     for (auto& p : props) {
         if (!p.property)
             continue;
-        auto us = p.property->used_variables();
+        const auto& us = p.property->used_vars();
         used.insert(used.end(), us.begin(), us.end());
     }
     for (auto& child : children) {
@@ -752,13 +862,27 @@ std::vector<std::string> UINode::UsedFieldVars()
     return used;
 }
 
+bool UINode::UsesFieldVar(std::string_view var)
+{
+    for (auto& p : Properties()) {
+        if (p.property && p.property->uses_variable(var))
+            return true;
+    }
+    for (auto& child : children) {
+        if (child->UsesFieldVar(var))
+            return true;
+    }
+    return false;
+}
+
 void UINode::RenameFieldVars(const std::string& oldn, const std::string& newn)
 {
     for (int i = 0; i < 2; ++i)
     {
         auto props = i ? Events() : Properties();
         for (auto& p : props) {
-            if (!p.property)
+            //cached lookup skips reparsing unaffected properties
+            if (!p.property || !p.property->uses_variable(oldn))
                 continue;
             p.property->rename_variable(oldn, newn);
         }
@@ -769,63 +893,69 @@ void UINode::RenameFieldVars(const std::string& oldn, const std::string& newn)
 
 //----------------------------------------------------
 
+template <class T>
+std::unique_ptr<Widget> CreateWidget(UIContext& ctx)
+{
+    return std::make_unique<T>(ctx);
+}
+
+//widget factories sorted by name for binary search during import
+struct WidgetType
+{
+    std::string_view name;
+    std::unique_ptr<Widget> (*create)(UIContext& ctx);
+};
+
+constexpr WidgetType WIDGET_TYPES[] = {
+    { "Button", CreateWidget<Button> },
+    { "CheckBox", CreateWidget<CheckBox> },
+    { "Child", CreateWidget<Child> },
+    { "CollapsingHeader", CreateWidget<CollapsingHeader> },
+    { "ColorEdit", CreateWidget<ColorEdit> },
+    { "Combo", CreateWidget<Combo> },
+    { "ContextMenu", CreateWidget<ContextMenu> },
+    { "CustomWidget", CreateWidget<CustomWidget> },
+    { "DockNode", CreateWidget<DockNode> },
+    { "DockSpace", CreateWidget<DockSpace> },
+    { "Image", CreateWidget<Image> },
+    { "Input", CreateWidget<Input> },
+    { "LogView", CreateWidget<LogView> },
+    { "MenuBar", CreateWidget<MenuBar> },
+    { "MenuIt", CreateWidget<MenuIt> },
+    { "Plot", CreateWidget<Plot> },
+    { "ProgressBar", CreateWidget<ProgressBar> },
+    { "RadioButton", CreateWidget<RadioButton> },
+    { "Selectable", CreateWidget<Selectable> },
+    { "Separator", CreateWidget<Separator> },
+    { "Slider", CreateWidget<Slider> },
+    { "Spacer", CreateWidget<Spacer> },
+    { "Splitter", CreateWidget<Splitter> },
+    { "TabBar", CreateWidget<TabBar> },
+    { "TabItem", CreateWidget<TabItem> },
+    { "Table", CreateWidget<Table> },
+    { "Text", CreateWidget<Text> },
+    { "TreeNode", CreateWidget<TreeNode> },
+};
+
+//std::is_sorted is constexpr only since C++20
+constexpr bool IsSorted(const WidgetType* b, const WidgetType* e)
+{
+    for (const WidgetType* it = b + 1; it < e; ++it)
+        if (!(it[-1].name < it->name))
+            return false;
+    return true;
+}
+
+static_assert(IsSorted(std::begin(WIDGET_TYPES), std::end(WIDGET_TYPES)), "WIDGET_TYPES must be sorted by name");
+
 std::unique_ptr<Widget>
 Widget::Create(const std::string& name, UIContext& ctx)
 {
-    if (name == "Text")
-        return std::make_unique<Text>(ctx);
-    else if (name == "Selectable")
-        return std::make_unique<Selectable>(ctx);
-    else if (name == "Button")
-        return std::make_unique<Button>(ctx);
-    else if (name == "CheckBox")
-        return std::make_unique<CheckBox>(ctx);
-    else if (name == "RadioButton")
-        return std::make_unique<RadioButton>(ctx);
-    else if (name == "Input")
-        return std::make_unique<Input>(ctx);
-    else if (name == "Combo")
-        return std::make_unique<Combo>(ctx);
-    else if (name == "Slider")
-        return std::make_unique<Slider>(ctx);
-    else if (name == "ProgressBar")
-        return std::make_unique<ProgressBar>(ctx);
-    else if (name == "ColorEdit")
-        return std::make_unique<ColorEdit>(ctx);
-    else if (name == "Image")
-        return std::make_unique<Image>(ctx);
-    else if (name == "Spacer")
-        return std::make_unique<Spacer>(ctx);
-    else if (name == "Separator")
-        return std::make_unique<Separator>(ctx);
-    else if (name == "CustomWidget")
-        return std::make_unique<CustomWidget>(ctx);
-    else if (name == "Table")
-        return std::make_unique<Table>(ctx);
-    else if (name == "Child")
-        return std::make_unique<Child>(ctx);
-    else if (name == "CollapsingHeader")
-        return std::make_unique<CollapsingHeader>(ctx);
-    else if (name == "TabBar")
-        return std::make_unique<TabBar>(ctx);
-    else if (name == "TabItem")
-        return std::make_unique<TabItem>(ctx);
-    else if (name == "TreeNode")
-        return std::make_unique<TreeNode>(ctx);
-    else if (name == "MenuBar")
-        return std::make_unique<MenuBar>(ctx);
-    else if (name == "ContextMenu")
-        return std::make_unique<ContextMenu>(ctx);
-    else if (name == "MenuIt")
-        return std::make_unique<MenuIt>(ctx);
-    else if (name == "Splitter")
-        return std::make_unique<Splitter>(ctx);
-    else if (name == "DockSpace")
-        return std::make_unique<DockSpace>(ctx);
-    else if (name == "DockNode")
-        return std::make_unique<DockNode>(ctx);
-    else
+    auto it = std::lower_bound(std::begin(WIDGET_TYPES), std::end(WIDGET_TYPES), name,
+        [](const WidgetType& wt, std::string_view n) { return wt.name < n; });
+    if (it == std::end(WIDGET_TYPES) || it->name != name)
         return {};
+    return it->create(ctx);
 }
 
 Widget::Widget()
@@ -1467,6 +1597,9 @@ void Widget::Export(std::ostream& os, UIContext& ctx)
     ctx.stretchSizeExpr = { "", "" };
     const int defSpacing = (l.flags & Layout::Topmost) ? 0 : 1;
     std::string hbName, vbName;
+    //constant conditions are folded, import restores the equal empty defaults
+    const bool visibleIf = !visible.empty() && !(visible.has_value() && visible.value());
+    const bool disabledIf = !disabled.empty() && !(disabled.has_value() && !disabled.value());
 
     if (userCodeBefore != "")
         os << userCodeBefore << "\n";
@@ -1474,6 +1607,16 @@ void Widget::Export(std::ostream& os, UIContext& ctx)
     std::string stype = GetTypeName();
     os << ctx.ind << "/// @begin " << stype << "\n";
 
+    //containers are timed including their children within their own scope
+    const bool profile = ctx.profile && (Behavior() & SnapInterior);
+    if (profile)
+    {
+        os << ctx.ind << "{\n";
+        ctx.ind_up();
+        os << ctx.ind << "IMRAD_PROFILE_SCOPE(\"" << ctx.codeGen->GetName() << "/" << stype
+            << " " << GetParentIndexes(ctx) << l.index << "\");\n";
+    }
+
     //layout commands first even when !visible
     if (!hasPos && nextColumn)
     {
@@ -1513,7 +1656,7 @@ void Widget::Export(std::ostream& os, UIContext& ctx)
         ctx.stretchSizeExpr[0] = hbName + ".GetSize()";
     }
 
-    if (!visible.empty())
+    if (visibleIf)
     {
         os << ctx.ind << "if (" << visible.to_arg() << ")\n" << ctx.ind << "{\n";
         ctx.ind_up();
@@ -1549,7 +1692,10 @@ void Widget::Export(std::ostream& os, UIContext& ctx)
         if (sameLine)
         {
             os << ctx.ind << "ImGui::SameLine(";
-            os << "0, " << spacing << " * ImGui::GetStyle().ItemSpacing.x";
+            if (spacing == 0)
+                os << "0, 0";
+            else if (spacing != 1) //default spacing needs no arguments
+                os << "0, " << spacing << " * ImGui::GetStyle().ItemSpacing.x";
             os << ");\n";
         }
         else if (spacing - defSpacing)
@@ -1566,7 +1712,7 @@ void Widget::Export(std::ostream& os, UIContext& ctx)
     {
         os << ctx.ind << "ImGui::SetNextItemAllowOverlap();\n";
     }
-    if (!disabled.empty())
+    if (disabledIf)
     {
         os << ctx.ind << "ImGui::BeginDisabled(" << disabled.to_arg() << ");\n";
     }
@@ -1693,7 +1839,7 @@ void Widget::Export(std::ostream& os, UIContext& ctx)
     {
         os << ctx.ind << "ImGui::PopItemFlag();\n";
     }
-    if (!disabled.empty())
+    if (disabledIf)
     {
         os << ctx.ind << "ImGui::EndDisabled();\n";
     }
@@ -1838,7 +1984,7 @@ void Widget::Export(std::ostream& os, UIContext& ctx)
         ctx.ind_down();
     }
 
-    if (!visible.empty())
+    if (visibleIf)
     {
         ctx.ind_down();
         os << ctx.ind << "}\n";
@@ -1860,6 +2006,11 @@ void Widget::Export(std::ostream& os, UIContext& ctx)
         }
     }
 
+    if (profile)
+    {
+        ctx.ind_down();
+        os << ctx.ind << "}\n";
+    }
     os << ctx.ind << "/// @end " << stype << "\n\n";
 
     if (userCodeAfter != "")
@@ -1874,6 +2025,7 @@ void Widget::Import(cpp::stmt_iterator& sit, UIContext& ctx)
     userCodeBefore = ctx.userCode;
     spacing = -1;
     int ignoreLevel = -1;
+    bool cullBrace = false;
 
     while (sit != cpp::stmt_iterator())
     {
@@ -1933,9 +2085,16 @@ void Widget::Import(cpp::stmt_iterator& sit, UIContext& ctx)
         }
         else if (ctx.importState == 2)
         {
-            if (ctx.userCode != "")
-                ctx.userCode += "\n";
-            ctx.userCode += sit->line;
+            if (int cull = ImportCullCode(sit->line, cullBrace)) {
+                if (cull == 1)
+                    if (auto* child = dynamic_cast<Child*>(this))
+                        child->cullRows = true;
+            }
+            else {
+                if (ctx.userCode != "")
+                    ctx.userCode += "\n";
+                ctx.userCode += sit->line;
+            }
         }
         else if (sit->kind == cpp::IfBlock || sit->kind == cpp::IfCallBlock)
         {
@@ -2143,6 +2302,10 @@ void Widget::Import(cpp::stmt_iterator& sit, UIContext& ctx)
         {
             onItemDeactivatedAfterEdit.set_from_arg(sit->callee2);
         }
+        else if (sit->kind == cpp::CallExpr && sit->callee == "IMRAD_PROFILE_SCOPE")
+        {
+            //regenerated from TopWindow::profile
+        }
         else
         {
             DoImport(sit, ctx);
@@ -2705,8 +2868,50 @@ bool Widget::EventUI(int i, UIContext& ctx)
     return changed;
 }
 
-void Widget::TreeUI(UIContext& ctx)
+void Widget::TreeRows(std::vector<TreeRow>& rows, int level)
+{
+    rows.push_back({ this, level });
+    if (!itemCount.empty())
+    {
+        rows.push_back({ this, level + 1, true });
+        for (auto& child : child_iterator(children, false))
+            child->TreeRows(rows, level + 2);
+        for (auto& child : child_iterator(children, true))
+            child->TreeRows(rows, level + 1);
+    }
+    else
+    {
+        for (auto& child : children)
+            child->TreeRows(rows, level + 1);
+    }
+}
+
+void Widget::TreeUI(const TreeRow& row, UIContext& ctx)
 {
+    //rows are indented by the caller, all items are kept open
+    if (row.loop)
+    {
+        std::string icon = ICON_FA_RETWEET; // SHARE_NODES;
+        icon += "##IC" + std::to_string((unsigned long long)this);
+        std::string label = itemCount.index_name_or(ctx.codeGen->FOR_VAR_NAME);
+        label += " = 0.." + itemCount.limit.to_arg();
+        float sp = ImGui::GetFontSize() * 1.4f - ImGui::CalcTextSize(icon.c_str(), 0, true).x;
+        ImGui::Dummy({ sp, 0 });
+        ImGui::SameLine(0, 0);
+        bool selected = ctx.mode == UIContext::SnapInsert && ctx.snapParent == this;
+        ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyle().Colors[ImGuiCol_TextDisabled]);
+        //OpenOnDoubleClick is to block flickering
+        int flags = ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+        ImGui::SetNextItemOpen(true);
+        ImGui::TreeNodeEx(icon.c_str(), flags);
+        ImGui::PopStyleColor();
+        ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyle().Colors[selected ? ImGuiCol_ButtonHovered : ImGuiCol_TextDisabled]);
+        ImGui::SameLine();
+        ImGui::Text("%s", label.c_str());
+        ImGui::PopStyleColor();
+        return;
+    }
+
     std::string label, typeLabel;
     const auto props = Properties();
     for (const auto& p : props) {
@@ -2741,90 +2946,43 @@ void Widget::TreeUI(UIContext& ctx)
     ImGui::Dummy({ sp, 0 });
     ImGui::SameLine(0, 0);
 
-    ctx.parents.push_back(this);
-
     ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyle().Colors[ImGuiCol_TextDisabled]);
     ImGui::SetNextItemOpen(true, ImGuiCond_Always);
-    //we keep all items open, OpenOnDoubleClick is to block flickering
-    int flags = ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_OpenOnDoubleClick;
+    //OpenOnDoubleClick is to block flickering
+    int flags = ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_NoTreePushOnOpen;
     if (children.empty())
         flags |= ImGuiTreeNodeFlags_Leaf;
-    if (ImGui::TreeNodeEx(icon.c_str(), flags))
+    ImGui::TreeNodeEx(icon.c_str(), flags);
+    if (ImGui::IsItemClicked())
     {
-        if (ImGui::IsItemClicked())
-        {
-            if (ImGui::IsKeyDown(ImGuiKey_LeftCtrl) || ImGui::IsKeyDown(ImGuiKey_RightCtrl))
-                toggle(ctx.selected, this);
-            else
-                ctx.selected = { this };
-        }
-        ImGui::PopStyleColor();
-        ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyle().Colors[selected ? ImGuiCol_ButtonHovered : ImGuiCol_Text]);
-        ImGui::SameLine();
-        if (label != "") {
-            ImGui::Text("\"");
-            ImGui::SameLine(0, 0);
-            float avail = ImGui::GetContentRegionAvail().x -
-                ImGui::CalcTextSize(("\"" + suff).c_str()).x -
-                ImGui::GetStyle().ItemSpacing.x; //emulate WindowPadding which is set to 0
-            if (suff.size())
-                avail -= ImGui::GetStyle().ItemSpacing.x;
-            ImGui::PushFont(!IsAscii(label) ? ctx.defaultStyleFont : ImGui::GetFont());
-            ImGui::TextAligned(0, avail, "%s", label.c_str());
-            ImGui::PopFont();
-            ImGui::SameLine(0, 0);
-            ImGui::Text("\"");
-        }
-        else {
-            ImGui::Text("%s", typeLabel.c_str());
-        }
-        ImGui::PopStyleColor();
-        ImGui::SameLine();
-        ImGui::TextDisabled("%s", suff.c_str());
-
-        if (!itemCount.empty())
-        {
-            std::string icon = ICON_FA_RETWEET; // SHARE_NODES;
-            icon += "##IC" + std::to_string((unsigned long long)this);
-            std::string label = itemCount.index_name_or(ctx.codeGen->FOR_VAR_NAME);
-            label += " = 0.." + itemCount.limit.to_arg();
-            float sp = ImGui::GetFontSize() * 1.4f - ImGui::CalcTextSize(icon.c_str(), 0, true).x;
-            ImGui::Dummy({ sp, 0 });
-            ImGui::SameLine(0, 0);
-            bool selected = ctx.mode == UIContext::SnapInsert && ctx.snapParent == this;
-            ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyle().Colors[ImGuiCol_TextDisabled]);
-            //we keep all items open, OpenOnDoubleClick is to block flickering
-            int flags = ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_OpenOnDoubleClick;
-            ImGui::SetNextItemOpen(true);
-            if (ImGui::TreeNodeEx(icon.c_str(), flags))
-            {
-                ImGui::PopStyleColor();
-                ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyle().Colors[selected ? ImGuiCol_ButtonHovered : ImGuiCol_TextDisabled]);
-                ImGui::SameLine();
-                ImGui::Text("%s", label.c_str());
-                ImGui::PopStyleColor();
-                for (auto& child : child_iterator(children, false))
-                    child->TreeUI(ctx);
-                ImGui::TreePop();
-            }
-            else {
-                ImGui::PopStyleColor();
-            }
-            for (auto& child : child_iterator(children, true))
-                child->TreeUI(ctx);
-        }
+        if (ImGui::IsKeyDown(ImGuiKey_LeftCtrl) || ImGui::IsKeyDown(ImGuiKey_RightCtrl))
+            toggle(ctx.selected, this);
         else
-        {
-            for (auto& child : children)
-                child->TreeUI(ctx);
-        }
-        ImGui::TreePop();
+            ctx.selected = { this };
+    }
+    ImGui::PopStyleColor();
+    ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyle().Colors[selected ? ImGuiCol_ButtonHovered : ImGuiCol_Text]);
+    ImGui::SameLine();
+    if (label != "") {
+        ImGui::Text("\"");
+        ImGui::SameLine(0, 0);
+        float avail = ImGui::GetContentRegionAvail().x -
+            ImGui::CalcTextSize(("\"" + suff).c_str()).x -
+            ImGui::GetStyle().ItemSpacing.x; //emulate WindowPadding which is set to 0
+        if (suff.size())
+            avail -= ImGui::GetStyle().ItemSpacing.x;
+        ImGui::PushFont(!IsAscii(label) ? ctx.defaultStyleFont : ImGui::GetFont());
+        ImGui::TextAligned(0, avail, "%s", label.c_str());
+        ImGui::PopFont();
+        ImGui::SameLine(0, 0);
+        ImGui::Text("\"");
     }
     else {
-        ImGui::PopStyleColor();
+        ImGui::Text("%s", typeLabel.c_str());
     }
-
-    ctx.parents.pop_back();
+    ImGui::PopStyleColor();
+    ImGui::SameLine();
+    ImGui::TextDisabled("%s", suff.c_str());
 }
 
 //----------------------------------------------------
@@ -3073,6 +3231,8 @@ ImDrawList* Text::DoDraw(UIContext& ctx)
     
     if (link)
         ImGui::TextLink(ps.label.c_str());
+    else if (wrap)
+        ImRad::TextWrapCached(ps.label.c_str());
     else
         ImGui::TextUnformatted(ps.label.c_str());
         
@@ -3134,6 +3294,11 @@ void Text::DoExport(std::ostream& os, UIContext& ctx)
         else
             os << ";\n";
     }
+    else if (wrap)
+    {
+        //wrap positions are cached between frames
+        os << ctx.ind << "ImRad::TextWrapCached(" << text.to_arg() << ");\n";
+    }
     else
     {
         os << ctx.ind << "ImGui::TextUnformatted(" << text.to_arg() << ");\n";
@@ -3153,7 +3318,8 @@ void Text::DoImport(const cpp::stmt_iterator& sit, UIContext& ctx)
     {
         alignToFrame = true;
     }
-    else if (sit->kind == cpp::CallExpr && sit->callee == "ImGui::TextUnformatted")
+    else if (sit->kind == cpp::CallExpr && 
+        (sit->callee == "ImGui::TextUnformatted" || sit->callee == "ImRad::TextWrapCached"))
     {
         if (sit->params.size() >= 1) {
             text.set_from_arg(sit->params[0]);
@@ -3427,7 +3593,8 @@ void Selectable::DoExport(std::ostream& os, UIContext& ctx)
     if (PrepareString(label.value()).error)
         PushError(ctx, "label is formatted wrongly");
 
-    os << "ImRad::Selectable(" << label.to_arg() << ", ";
+    std::string hid = HashedId(label.to_arg(), ctx);
+    os << "ImRad::Selectable(" << (hid != "" ? hid + ", " : "") << label.to_arg() << ", ";
     if (selected.is_reference())
         os << "&" << selected.to_arg();
     else
@@ -3512,24 +3679,25 @@ void Selectable::DoImport(const cpp::stmt_iterator& sit, UIContext& ctx)
         (sit->kind == cpp::IfCallThenCall && sit->callee == "ImGui::Selectable")) //compatibility
     {
         ctx.importLevel = sit->level;
+        auto params = UnhashedParams(sit);
 
-        if (sit->params.size() >= 1) {
-            if (!label.set_from_arg(sit->params[0]))
+        if (params.size() >= 1) {
+            if (!label.set_from_arg(params[0]))
                 PushError(ctx, "unable to parse label");
         }
-        if (sit->params.size() >= 2) {
-            if (!sit->params[1].compare(0, 1, "&"))
-                selected.set_from_arg(sit->params[1].substr(1));
+        if (params.size() >= 2) {
+            if (!params[1].compare(0, 1, "&"))
+                selected.set_from_arg(params[1].substr(1));
             else
-                selected.set_from_arg(sit->params[1]);
+                selected.set_from_arg(params[1]);
         }
-        if (sit->params.size() >= 3) {
-            std::string fl = Replace(sit->params[2], "ImGuiSelectableFlags_DontClosePopups", "ImGuiSelectableFlags_NoAutoClosePopups"); //compatibility
+        if (params.size() >= 3) {
+            std::string fl = Replace(params[2], "ImGuiSelectableFlags_DontClosePopups", "ImGuiSelectableFlags_NoAutoClosePopups"); //compatibility
             if (!flags.set_from_arg(fl))
-                PushError(ctx, "unrecognized flag in \"" + sit->params[2] + "\"");
+                PushError(ctx, "unrecognized flag in \"" + params[2] + "\"");
         }
-        if (sit->params.size() >= 4) {
-            auto sz = cpp::parse_size(sit->params[3]);
+        if (params.size() >= 4) {
+            auto sz = cpp::parse_size(params[3]);
             size_x.set_from_arg(sz.first);
             if (ctx.importVersion < 9000 && size_x.zero())
                 size_x = -1;
@@ -3833,6 +4001,13 @@ void Button::DoExport(std::ostream& os, UIContext& ctx)
     {
         os << "ImGui::SmallButton(" << label.to_arg() << ")";
     }
+    else if (std::string hid = HashedId(label.to_arg(), ctx); hid != "")
+    {
+        os << "ImRad::Button(" << hid << ", " << label.to_arg() << ", { "
+            << size_x.to_arg(ctx.unit, ctx.stretchSizeExpr[0]) << ", "
+            << size_y.to_arg(ctx.unit, ctx.stretchSizeExpr[1])
+            << " })";
+    }
     else
     {
         os << "ImGui::Button(" << label.to_arg() << ", { "
@@ -3872,13 +4047,15 @@ void Button::DoExport(std::ostream& os, UIContext& ctx)
 void Button::DoImport(const cpp::stmt_iterator& sit, UIContext& ctx)
 {
     if ((sit->kind == cpp::CallExpr || sit->kind == cpp::IfCallBlock) &&
-        sit->callee == "ImGui::Button")
+        (sit->callee == "ImGui::Button" || sit->callee == "ImRad::Button"))
     {
         ctx.importLevel = sit->level;
-        label.set_from_arg(sit->params[0]);
+        auto params = UnhashedParams(sit);
+        if (params.size())
+            label.set_from_arg(params[0]);
 
-        if (sit->params.size() >= 2) {
-            auto size = cpp::parse_size(sit->params[1]);
+        if (params.size() >= 2) {
+            auto size = cpp::parse_size(params[1]);
             size_x.set_from_arg(size.first);
             size_y.set_from_arg(size.second);
         }
@@ -4166,7 +4343,8 @@ void CheckBox::DoExport(std::ostream& os, UIContext& ctx)
     if (!checked.is_reference())
         PushError(ctx, "checked only binds to l-values");
 
-    os << "ImGui::Checkbox("
+    std::string hid = HashedId(label.to_arg(), ctx);
+    os << (hid != "" ? "ImRad::Checkbox(" + hid + ", " : "ImGui::Checkbox(")
         << label.to_arg() << ", "
         << "&" << checked.to_arg()
         << ")";
@@ -4192,14 +4370,15 @@ void CheckBox::DoImport(const cpp::stmt_iterator& sit, UIContext& ctx)
         if (sit->params.size() >= 2)
             style_check.set_from_arg(sit->params[1]);
     }
-    else if ((sit->kind == cpp::CallExpr && sit->callee == "ImGui::Checkbox") ||
-        (sit->kind == cpp::IfCallThenCall && sit->callee == "ImGui::Checkbox"))
+    else if ((sit->kind == cpp::CallExpr || sit->kind == cpp::IfCallThenCall) &&
+        (sit->callee == "ImGui::Checkbox" || sit->callee == "ImRad::Checkbox"))
     {
-        if (sit->params.size())
-            label.set_from_arg(sit->params[0]);
+        auto params = UnhashedParams(sit);
+        if (params.size())
+            label.set_from_arg(params[0]);
 
-        if (sit->params.size() >= 2 && !sit->params[1].compare(0, 1, "&"))
-            checked.set_from_arg(sit->params[1].substr(1));
+        if (params.size() >= 2 && !params[1].compare(0, 1, "&"))
+            checked.set_from_arg(params[1].substr(1));
 
         if (sit->kind == cpp::IfCallThenCall)
             onChange.set_from_arg(sit->callee2);
@@ -4751,10 +4930,15 @@ void Input::DoExport(std::ostream& os, UIContext& ctx)
     }
     else if (tid == "std::string")
     {
+        //only hidden labels benefit from the ID based overloads
+        std::string hid = !id.compare(0, 3, "\"##") ? HashedId(id, ctx) : "";
+        std::string ns = hid != "" ? "ImRad::" : "ImGui::";
+        if (hid != "")
+            hid += ", ";
         if (!hint.empty())
-            os << "ImGui::InputTextWithHint(" << id << ", " << hint.to_arg() << ", ";
+            os << ns << "InputTextWithHint(" << hid << id << ", " << hint.to_arg() << ", ";
         else
-            os << "ImGui::InputText(" << id << ", ";
+            os << ns << "InputText(" << hid << id << ", ";
         os << "&" << value.to_arg() << ", " << flags.to_arg();
         if (!onCallback.empty())
             os << ", IMRAD_INPUTTEXT_EVENT(" << ctx.codeGen->GetName() << ", " << onCallback.to_arg() << ")";
@@ -4854,28 +5038,28 @@ void Input::DoImport(const cpp::stmt_iterator& sit, UIContext& ctx)
         if (sit->kind == cpp::IfCallThenCall)
             onChange.set_from_arg(sit->callee2);
     }
-    else if ((sit->kind == cpp::CallExpr && !sit->callee.compare(0, 16, "ImGui::InputText")) ||
-        (sit->kind == cpp::IfCallThenCall && !sit->callee.compare(0, 16, "ImGui::InputText")) ||
-        (sit->kind == cpp::IfCallBlock && !sit->callee.compare(0, 16, "ImGui::InputText")))
+    else if ((sit->kind == cpp::CallExpr || sit->kind == cpp::IfCallThenCall || sit->kind == cpp::IfCallBlock) &&
+        (!sit->callee.compare(0, 16, "ImGui::InputText") || !sit->callee.compare(0, 16, "ImRad::InputText")))
     {
-        if (sit->params.size()) {
-            label.set_from_arg(sit->params[0]);
+        auto params = UnhashedParams(sit);
+        if (params.size()) {
+            label.set_from_arg(params[0]);
             if (!label.access()->compare(0, 2, "##"))
                 label = "";
         }
 
         size_t i = 0;
-        if (sit->callee == "ImGui::InputTextWithHint") {
-            hint = cpp::parse_str_arg(sit->params[1]);
+        if (!sit->callee.compare(7, std::string::npos, "InputTextWithHint") && params.size() >= 2) {
+            hint = cpp::parse_str_arg(params[1]);
             ++i;
         }
 
-        if (sit->params.size() > 1 + i)
+        if (params.size() > 1 + i)
         {
-            std::string expr = sit->params[1 + i];
+            std::string expr = params[1 + i];
             if (!expr.compare(0, 1, "&")) {
                 type.set_id("std::string");
-                value.set_from_arg(sit->params[1 + i].substr(1));
+                value.set_from_arg(params[1 + i].substr(1));
             }
             else if (!expr.compare(expr.size() - 9, 9, ".InputBuf")) {
                 type.set_id("ImGuiTextFilter");
@@ -4884,16 +5068,16 @@ void Input::DoImport(const cpp::stmt_iterator& sit, UIContext& ctx)
             }
         }
 
-        if (sit->params.size() > 2 + i)
+        if (params.size() > 2 + i)
         {
-            if (!flags.set_from_arg(sit->params[2 + i]))
-                PushError(ctx, "unrecognized flag in \"" + sit->params[2 + i] + "\"");
+            if (!flags.set_from_arg(params[2 + i]))
+                PushError(ctx, "unrecognized flag in \"" + params[2 + i] + "\"");
         }
 
-        if (sit->params.size() > 3 + i &&
-            !sit->params[3 + i].compare(0, 22, "IMRAD_INPUTTEXT_EVENT("))
+        if (params.size() > 3 + i &&
+            !params[3 + i].compare(0, 22, "IMRAD_INPUTTEXT_EVENT("))
         {
-            const std::string& arg = sit->params[3 + i];
+            const std::string& arg = params[3 + i];
             size_t j = arg.find(',');
             onCallback.set_from_arg(arg.substr(j + 1, arg.size() - j - 2));
         }
@@ -5120,20 +5304,20 @@ bool Input::PropertyUI(int i, UIContext& ctx)
     {
         int type = imeType & 0xff;
         int action = imeType & (~0xff);
-        std::string val = _imeClass.find_id(type)->first.substr(7);
+        std::string val(_imeClass.find_id(type)->first.substr(7));
         if (action)
-            val += " | " + _imeAction.find_id(action)->first.substr(7);
+            val += " | " + std::string(_imeAction.find_id(action)->first.substr(7));
         TreeNodeProp("imeType", ctx.pgbFont, val, [&] {
             ImGui::TableNextColumn();
             ImGui::Spacing();
             for (const auto& id : _imeClass.get_ids()) {
                 int pre = !id.first.compare(0, 7, "ImRad::") ? 7 : 0;
-                changed |= ImGui::RadioButton(id.first.substr(pre).c_str(), &type, id.second);
+                changed |= ImGui::RadioButton(id.first.data() + pre, &type, id.second);
             }
             ImGui::Separator();
             for (const auto& id : _imeAction.get_ids()) {
                 int pre = !id.first.compare(0, 7, "ImRad::") ? 7 : 0;
-                changed |= ImGui::RadioButton(id.first.substr(pre).c_str(), &action, id.second);
+                changed |= ImGui::RadioButton(id.first.data() + pre, &action, id.second);
             }
             imeType = type | action;
             });
@@ -6407,7 +6591,8 @@ void Image::DoImport(const cpp::stmt_iterator& sit, UIContext& ctx)
                 size_y.set_from_arg(size.second);
         }
 
-        RefreshTexture(ctx);
+        if (ctx.loadTextures)
+            RefreshTexture(ctx);
     }
     else if (sit->kind == cpp::Comment && sit->line == "//StretchPolicy::None")
     {
@@ -6621,3 +6806,340 @@ bool CustomWidget::EventUI(int i, UIContext& ctx)
     }
     return changed;
 }
+
+//----------------------------------------------------
+
+LogView::LogView(UIContext& ctx)
+{
+    size_x = -1;
+    size_y = 200;
+
+    if (ctx.createVars)
+        log.set_from_arg(ctx.codeGen->CreateVar("ImRad::LogBuffer", "", CppGen::Var::Interface));
+}
+
+std::unique_ptr<Widget> LogView::Clone(UIContext& ctx)
+{
+    auto sel = std::make_unique<LogView>(*this);
+    if (ctx.createVars && log.has_single_variable()) {
+        sel->log.set_from_arg(ctx.codeGen->CreateVar("ImRad::LogBuffer", "", CppGen::Var::Interface));
+    }
+    return sel;
+}
+
+ImDrawList* LogView::DoDraw(UIContext& ctx)
+{
+    ImVec2 size;
+    size.x = size_x.eval_px(ImGuiAxis_X, ctx);
+    size.y = size_y.eval_px(ImGuiAxis_Y, ctx);
+
+    std::string id = std::to_string((uintptr_t)this);
+    ImGui::BeginChild(id.c_str(), size, ImGuiChildFlags_FrameStyle, ImGuiWindowFlags_NoScrollbar);
+    ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyleColorVec4(ImGuiCol_TextDisabled));
+    for (int i = 0; i < 3; ++i)
+        ImGui::Text("[log line %d]", i + 1);
+    ImGui::PopStyleColor();
+    ImGui::EndChild();
+
+    return ImGui::GetWindowDrawList();
+}
+
+void LogView::DoExport(std::ostream& os, UIContext& ctx)
+{
+    if (log.empty()) {
+        PushError(ctx, "log not set");
+        return;
+    }
+
+    os << ctx.ind << "ImRad::LogView(\"##" << log.to_arg() << "\", "
+        << log.to_arg() << ", { "
+        << size_x.to_arg(ctx.unit, ctx.stretchSizeExpr[0]) << ", "
+        << size_y.to_arg(ctx.unit, ctx.stretchSizeExpr[1]) << " }";
+    if (!filter.empty() || !autoScroll)
+        os << ", " << (filter.empty() ? "nullptr" : filter.to_arg());
+    if (!autoScroll)
+        os << ", false";
+    os << ");\n";
+}
+
+void LogView::DoImport(const cpp::stmt_iterator& sit, UIContext& ctx)
+{
+    if (sit->kind == cpp::CallExpr && sit->callee == "ImRad::LogView")
+    {
+        if (sit->params.size() >= 2)
+            log.set_from_arg(sit->params[1]);
+
+        if (sit->params.size() >= 3) {
+            auto siz = cpp::parse_size(sit->params[2]);
+            size_x.set_from_arg(siz.first);
+            size_y.set_from_arg(siz.second);
+        }
+
+        if (sit->params.size() >= 4 && sit->params[3] != "nullptr")
+            filter.set_from_arg(sit->params[3]);
+
+        if (sit->params.size() >= 5)
+            autoScroll = sit->params[4] != "false";
+    }
+}
+
+std::vector<UINode::Prop>
+LogView::Properties()
+{
+    auto props = Widget::Properties();
+    props.insert(props.begin(), {
+        { "appearance.text", &style_text },
+        { "appearance.frameBg", &style_frameBg },
+        { "appearance.font.summary", nullptr },
+        { "appearance.font.name", &style_fontName },
+        { "appearance.font.size", &style_fontSize },
+        { "behavior.autoScroll##logView", &autoScroll },
+        { "bindings.log##logView", &log },
+        { "bindings.filter##logView", &filter },
+        });
+    return props;
+}
+
+bool LogView::PropertyUI(int i, UIContext& ctx)
+{
+    bool changed = false;
+    int fl;
+    switch (i)
+    {
+    case 0:
+        ImGui::Text("text");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        changed = InputBindable(&style_text, ImGuiCol_Text, ctx);
+        ImGui::SameLine(0, 0);
+        changed |= BindingButton("text", &style_text, ctx);
+        break;
+    case 1:
+        ImGui::Text("frameBg");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        changed = InputBindable(&style_frameBg, ImGuiCol_FrameBg, ctx);
+        ImGui::SameLine(0, 0);
+        changed |= BindingButton("frameBg", &style_frameBg, ctx);
+        break;
+    case 2:
+        ImGui::Text("font");
+        ImGui::TableNextColumn();
+        TextFontInfo(ctx);
+        break;
+    case 3:
+        ImGui::Text("name");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        changed = InputBindable(&style_fontName, ctx);
+        ImGui::SameLine(0, 0);
+        changed |= BindingButton("font", &style_fontName, ctx);
+        break;
+    case 4:
+        ImGui::Text("size");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        changed = InputBindable(&style_fontSize, InputBindable_ParentStr, ctx);
+        ImGui::SameLine(0, 0);
+        changed |= BindingButton("font_size", &style_fontSize, ctx);
+        break;
+    case 5:
+        ImGui::Text("autoScroll");
+        ImGui::TableNextColumn();
+        fl = autoScroll != Defaults().autoScroll ? InputDirectVal_Modified : 0;
+        changed = InputDirectVal(&autoScroll, fl, ctx);
+        break;
+    case 6:
+        ImGui::Text("log");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        changed = InputFieldRef(&log, "ImRad::LogBuffer", false, ctx);
+        break;
+    case 7:
+        ImGui::Text("filter");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        changed = InputBindable(&filter, 0, ctx);
+        ImGui::SameLine(0, 0);
+        changed |= BindingButton("filter", &filter, ctx);
+        break;
+    default:
+        return Widget::PropertyUI(i - 8, ctx);
+    }
+    return changed;
+}
+
+//----------------------------------------------------
+
+Plot::Plot(UIContext& ctx)
+{
+    size_x = 200;
+    size_y = 100;
+
+    if (ctx.createVars)
+        values.set_from_arg(ctx.codeGen->CreateVar("std::vector<float>", "", CppGen::Var::Interface));
+}
+
+std::unique_ptr<Widget> Plot::Clone(UIContext& ctx)
+{
+    auto sel = std::make_unique<Plot>(*this);
+    if (ctx.createVars && values.has_single_variable()) {
+        sel->values.set_from_arg(ctx.codeGen->CreateVar("std::vector<float>", "", CppGen::Var::Interface));
+    }
+    return sel;
+}
+
+ImDrawList* Plot::DoDraw(UIContext& ctx)
+{
+    static std::vector<float> data;
+    if (data.empty()) {
+        data.resize(1000);
+        for (size_t i = 0; i < data.size(); ++i)
+            data[i] = std::sin(i * 0.02f) + 0.3f * std::sin(i * 0.37f);
+    }
+
+    if (!style_color.empty())
+        ImGui::PushStyleColor(ImGuiCol_PlotLines, style_color.eval(ImGuiCol_PlotLines, ctx));
+
+    ImVec2 size;
+    size.x = size_x.eval_px(ImGuiAxis_X, ctx);
+    size.y = size_y.eval_px(ImGuiAxis_Y, ctx);
+    std::string id = std::to_string((uintptr_t)this);
+    ImRad::PlotLines(id.c_str(), data, size);
+
+    if (!style_color.empty())
+        ImGui::PopStyleColor();
+
+    return ImGui::GetWindowDrawList();
+}
+
+void Plot::DoExport(std::ostream& os, UIContext& ctx)
+{
+    if (values.empty()) {
+        PushError(ctx, "values not set");
+        return;
+    }
+
+    if (!style_color.empty())
+        os << ctx.ind << "ImGui::PushStyleColor(ImGuiCol_PlotLines, "
+            << style_color.to_arg() << ");\n";
+
+    os << ctx.ind << "ImRad::PlotLines(\"##" << values.to_arg() << "\", "
+        << values.to_arg() << ", { "
+        << size_x.to_arg(ctx.unit, ctx.stretchSizeExpr[0]) << ", "
+        << size_y.to_arg(ctx.unit, ctx.stretchSizeExpr[1]) << " }";
+    if (!scaleMin.empty() || !scaleMax.empty())
+    {
+        os << ", " << (scaleMin.empty() ? "FLT_MAX" : scaleMin.to_arg())
+            << ", " << (scaleMax.empty() ? "FLT_MAX" : scaleMax.to_arg());
+    }
+    os << ");\n";
+
+    if (!style_color.empty())
+        os << ctx.ind << "ImGui::PopStyleColor();\n";
+}
+
+void Plot::DoImport(const cpp::stmt_iterator& sit, UIContext& ctx)
+{
+    if (sit->kind == cpp::CallExpr && sit->callee == "ImRad::PlotLines")
+    {
+        if (sit->params.size() >= 2)
+            values.set_from_arg(sit->params[1]);
+
+        if (sit->params.size() >= 3) {
+            auto siz = cpp::parse_size(sit->params[2]);
+            size_x.set_from_arg(siz.first);
+            size_y.set_from_arg(siz.second);
+        }
+
+        if (sit->params.size() >= 4 && sit->params[3] != "FLT_MAX")
+            scaleMin.set_from_arg(sit->params[3]);
+
+        if (sit->params.size() >= 5 && sit->params[4] != "FLT_MAX")
+            scaleMax.set_from_arg(sit->params[4]);
+    }
+    else if (sit->kind == cpp::CallExpr && sit->callee == "ImGui::PushStyleColor")
+    {
+        if (sit->params.size() >= 2 && sit->params[0] == "ImGuiCol_PlotLines")
+            style_color.set_from_arg(sit->params[1]);
+    }
+}
+
+std::vector<UINode::Prop>
+Plot::Properties()
+{
+    auto props = Widget::Properties();
+    props.insert(props.begin(), {
+        { "appearance.frameBg", &style_frameBg },
+        { "appearance.color", &style_color },
+        { "appearance.border", &style_border },
+        { "appearance.borderSize", &style_frameBorderSize },
+        { "behavior.scaleMin##plot", &scaleMin },
+        { "behavior.scaleMax##plot", &scaleMax },
+        { "bindings.values##plot", &values },
+        });
+    return props;
+}
+
+bool Plot::PropertyUI(int i, UIContext& ctx)
+{
+    bool changed = false;
+    switch (i)
+    {
+    case 0:
+        ImGui::Text("frameBg");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        changed = InputBindable(&style_frameBg, ImGuiCol_FrameBg, ctx);
+        ImGui::SameLine(0, 0);
+        changed |= BindingButton("frameBg", &style_frameBg, ctx);
+        break;
+    case 1:
+        ImGui::Text("color");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        changed = InputBindable(&style_color, ImGuiCol_PlotLines, ctx);
+        ImGui::SameLine(0, 0);
+        changed |= BindingButton("color", &style_color, ctx);
+        break;
+    case 2:
+        ImGui::Text("border");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        changed = InputBindable(&style_border, ImGuiCol_Border, ctx);
+        ImGui::SameLine(0, 0);
+        changed |= BindingButton("border", &style_border, ctx);
+        break;
+    case 3:
+        ImGui::Text("borderSize");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        changed = InputDirectVal(&style_frameBorderSize, ctx);
+        break;
+    case 4:
+        ImGui::Text("scaleMin");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        changed = InputBindable(&scaleMin, InputBindable_ShowVariables, ctx);
+        ImGui::SameLine(0, 0);
+        changed |= BindingButton("scaleMin", &scaleMin, ctx);
+        break;
+    case 5:
+        ImGui::Text("scaleMax");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        changed = InputBindable(&scaleMax, InputBindable_ShowVariables, ctx);
+        ImGui::SameLine(0, 0);
+        changed |= BindingButton("scaleMax", &scaleMax, ctx);
+        break;
+    case 6:
+        ImGui::Text("values");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        changed = InputFieldRef(&values, "std::vector<float>", false, ctx);
+        break;
+    default:
+        return Widget::PropertyUI(i - 7, ctx);
+    }
+    return changed;
+}
@@ -37,6 +37,12 @@ struct UINode
         property_base* property;
         bool kbdInput = false; //this property accepts keyboard input by default
     };
+    //flattened hierarchy row
+    struct TreeRow {
+        UINode* node;
+        int level;
+        bool loop = false; //itemCount row of the node
+    };
     enum SnapOptions {
         SnapSides = 0x1,
         SnapInterior = 0x2,
@@ -53,7 +59,8 @@ struct UINode
     virtual ~UINode() {}
     virtual void Draw(UIContext& ctx) = 0;
     virtual void DrawTools(UIContext& ctx) = 0;
-    virtual void TreeUI(UIContext& ctx) = 0;
+    virtual void TreeRows(std::vector<TreeRow>& rows, int level) = 0;
+    virtual void TreeUI(const TreeRow& row, UIContext& ctx) = 0;
     virtual auto Properties()->std::vector<Prop> = 0;
     virtual auto Events()->std::vector<Prop> = 0;
     virtual bool PropertyUI(int, UIContext& ctx) = 0;
@@ -67,15 +74,18 @@ struct UINode
     void DrawInteriorRect(UIContext& ctx);
     void DrawSnap(UIContext& ctx);
     auto UsedFieldVars() -> std::vector<std::string>;
+    bool UsesFieldVar(std::string_view var);
     void RenameFieldVars(const std::string& oldn, const std::string& newn);
     auto FindChild(const UINode*) -> std::optional<std::pair<UINode*, int>>;
     auto FindInRect(const ImRect& r) -> std::vector<UINode*>;
     auto GetAllChildren() -> std::vector<UINode*>;
     void CloneChildrenFrom(const UINode& node, UIContext& ctx);
     void ResetLayout();
-    virtual auto GetTypeName()->std::string;
+    virtual auto GetTypeName()->std::string = 0;
     auto GetParentIndexes(UIContext& ctx)->std::string;
     void PushError(UIContext& ctx, const std::string& err);
+    void ExportCulledChildren(std::ostream& os, UIContext& ctx, const std::vector<Widget*>& items);
+    static int ImportCullCode(std::string_view line, bool& brace);
 
     struct child_iterator;
 
@@ -193,7 +203,8 @@ struct Widget : UINode
     auto Properties() -> std::vector<Prop>;
     auto Events() -> std::vector<Prop>;
     bool PropertyUI(int i, UIContext& ctx);
-    void TreeUI(UIContext& ctx);
+    void TreeRows(std::vector<TreeRow>& rows, int level);
+    void TreeUI(const TreeRow& row, UIContext& ctx);
     bool EventUI(int, UIContext& ctx);
     int Behavior();
     int ColumnCount(UIContext& ctx) { return 0; }
@@ -219,6 +230,7 @@ struct Spacer : Widget
     void DoExport(std::ostream&, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     int Behavior() { return Widget::Behavior() | HasSizeX | HasSizeY; }
+    std::string GetTypeName() { return "Spacer"; }
     const char* GetIcon() const { return ICON_FA_LEFT_RIGHT; }
     const Spacer& Defaults() { static Spacer var(UIContext::Defaults()); return var; }
 };
@@ -237,6 +249,7 @@ struct Separator : Widget
     bool PropertyUI(int, UIContext& ctx);
     void DoExport(std::ostream&, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
+    std::string GetTypeName() { return "Separator"; }
     const char* GetIcon() const { return ICON_FA_MINUS; }
     const Separator& Defaults() { static Separator var(UIContext::Defaults()); return var; }
 };
@@ -259,6 +272,7 @@ struct Text : Widget
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     void CalcSizeEx(ImVec2 p1, UIContext& ctx);
+    std::string GetTypeName() { return "Text"; }
     const char* GetIcon() const { return ICON_FA_FONT; }
     const Text& Defaults() { static Text var(UIContext::Defaults()); return var; }
 };
@@ -287,6 +301,7 @@ struct Selectable : Widget
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     void CalcSizeEx(ImVec2 p1, UIContext& ctx);
     int Behavior() { return Widget::Behavior() | HasSizeX | HasSizeY | SnapItemInterior; }
+    std::string GetTypeName() { return "Selectable"; }
     const char* GetIcon() const { return ICON_FA_AUDIO_DESCRIPTION; }
     const Selectable& Defaults() { static Selectable var(UIContext::Defaults()); return var; }
 };
@@ -311,6 +326,7 @@ struct Button : Widget
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     int Behavior();
+    std::string GetTypeName() { return "Button"; }
     const char* GetIcon() const { return ICON_FA_CIRCLE_PLAY; }
     const Button& Defaults() { static Button var(UIContext::Defaults()); return var; }
 };
@@ -331,6 +347,7 @@ struct CheckBox : Widget
     bool EventUI(int i, UIContext& ctx);
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
+    std::string GetTypeName() { return "CheckBox"; }
     const char* GetIcon() const { return ICON_FA_SQUARE_CHECK; }
     const CheckBox& Defaults() { static CheckBox var(UIContext::Defaults()); return var; }
 };
@@ -352,6 +369,7 @@ struct RadioButton : Widget
     bool EventUI(int i, UIContext& ctx);
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
+    std::string GetTypeName() { return "RadioButton"; }
     const char* GetIcon() const { return ICON_FA_CIRCLE_DOT; }
     const RadioButton& Defaults() { static RadioButton var(UIContext::Defaults()); return var; }
 };
@@ -383,6 +401,7 @@ struct Input : Widget
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     int Behavior();
+    std::string GetTypeName() { return "Input"; }
     const char* GetIcon() const { return "|a_|"; }
     const Input& Defaults() { static Input var(UIContext::Defaults()); return var; }
 };
@@ -405,6 +424,7 @@ struct Combo : Widget
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     int Behavior() { return Widget::Behavior() | HasSizeX; }
+    std::string GetTypeName() { return "Combo"; }
     const char* GetIcon() const { return ICON_FA_SQUARE_CARET_DOWN; }
     const Combo& Defaults() { static Combo var(UIContext::Defaults()); return var; }
 };
@@ -430,6 +450,7 @@ struct Slider : Widget
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     int Behavior() { return Widget::Behavior() | HasSizeX; }
+    std::string GetTypeName() { return "Slider"; }
     const char* GetIcon() const { return ICON_FA_SLIDERS; }
     const Slider& Defaults() { static Slider var(UIContext::Defaults()); return var; }
 };
@@ -448,6 +469,7 @@ struct ProgressBar : Widget
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     int Behavior() { return Widget::Behavior() | HasSizeX | HasSizeY; }
+    std::string GetTypeName() { return "ProgressBar"; }
     const char* GetIcon() const { return ICON_FA_BATTERY_HALF; }
     const ProgressBar& Defaults() { static ProgressBar var(UIContext::Defaults()); return var; }
 };
@@ -470,6 +492,7 @@ struct ColorEdit : Widget
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     int Behavior() { return Widget::Behavior() | HasSizeX; }
+    std::string GetTypeName() { return "ColorEdit"; }
     const char* GetIcon() const { return ICON_FA_CIRCLE_HALF_STROKE; }
     const ColorEdit& Defaults() { static ColorEdit var(UIContext::Defaults()); return var; }
 };
@@ -493,6 +516,7 @@ struct Image : Widget
     void RefreshTexture(UIContext& ctx);
     bool PickFileName(UIContext& ctx);
     int Behavior() { return Widget::Behavior() | HasSizeX | HasSizeY; }
+    std::string GetTypeName() { return "Image"; }
     const char* GetIcon() const { return ICON_FA_IMAGE; }
     const Image& Defaults() { static Image var(UIContext::Defaults()); return var; }
 };
@@ -511,6 +535,46 @@ struct CustomWidget : Widget
     void DoExport(std::ostream& os, UIContext& ctx);
     void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
     int Behavior() { return Widget::Behavior() | HasSizeX | HasSizeY; }
+    std::string GetTypeName() { return "CustomWidget"; }
     const char* GetIcon() const { return ICON_FA_EXPAND; }
     const CustomWidget& Defaults() { static CustomWidget var(UIContext::Defaults()); return var; }
 };
+
+struct LogView : Widget
+{
+    field_ref<void> log;
+    bindable<std::string> filter = "";
+    direct_val<bool> autoScroll = true;
+
+    LogView(UIContext& ctx);
+    auto Clone(UIContext& ctx)->std::unique_ptr<Widget>;
+    ImDrawList* DoDraw(UIContext& ctx);
+    auto Properties()->std::vector<Prop>;
+    bool PropertyUI(int i, UIContext& ctx);
+    void DoExport(std::ostream& os, UIContext& ctx);
+    void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
+    int Behavior() { return Widget::Behavior() | HasSizeX | HasSizeY; }
+    std::string GetTypeName() { return "LogView"; }
+    const char* GetIcon() const { return ICON_FA_RECEIPT; }
+    const LogView& Defaults() { static LogView var(UIContext::Defaults()); return var; }
+};
+
+struct Plot : Widget
+{
+    field_ref<void> values;
+    bindable<float> scaleMin;
+    bindable<float> scaleMax;
+    bindable<color_t> style_color;
+
+    Plot(UIContext& ctx);
+    auto Clone(UIContext& ctx)->std::unique_ptr<Widget>;
+    ImDrawList* DoDraw(UIContext& ctx);
+    auto Properties()->std::vector<Prop>;
+    bool PropertyUI(int i, UIContext& ctx);
+    void DoExport(std::ostream& os, UIContext& ctx);
+    void DoImport(const cpp::stmt_iterator& sit, UIContext& ctx);
+    int Behavior() { return Widget::Behavior() | HasSizeX | HasSizeY; }
+    std::string GetTypeName() { return "Plot"; }
+    const char* GetIcon() const { return ICON_FA_CHART_LINE; }
+    const Plot& Defaults() { static Plot var(UIContext::Defaults()); return var; }
+};
@@ -307,6 +307,7 @@ void TopWindow::Export(std::ostream& os, UIContext& ctx)
 
     ctx.codeGen->RemovePrefixedVars(std::string(ctx.codeGen->HBOX_NAME));
     ctx.codeGen->RemovePrefixedVars(std::string(ctx.codeGen->VBOX_NAME));
+    ctx.codeGen->RemovePrefixedVars(std::string(ctx.codeGen->CULL_NAME));
     RenameFieldVars(CUR_ITEM_SYMBOL, std::string(ctx.codeGen->CUR_ITEM_VAR_NAME));
 
     //todo: put before ///@ params
@@ -323,12 +324,35 @@ void TopWindow::Export(std::ostream& os, UIContext& ctx)
 
     os << ctx.ind << "/// @begin TopWindow\n";
     
+    ctx.profile = profile;
+    if (profile)
+    {
+        os << ctx.ind << "IMRAD_PROFILE_SCOPE(\"" << ctx.codeGen->GetName() << "\");\n";
+    }
     if (ctx.unit == "dp")
     {
         os << ctx.ind << "const float dp = ImRad::GetUserData().dpiScale;\n";
     }
 
-    if (kind == Popup || kind == ModalPopup)
+    //window ID doesn't depend on the ID stack when its name ends with ###
+    //direct children with literal labels consume it, it also marks hashIds for import
+    ctx.idSeed = "";
+    if (hashIds && kind != Popup &&
+        (kind == MainWindow || kind == Activity || title.value().find("##") == std::string::npos))
+    {
+        os << ctx.ind << "[[maybe_unused]] constexpr ImGuiID WINDOW_ID = ImRad::HashStr(\"###" << ctx.codeGen->GetName() << "\");\n";
+        ctx.idSeed = "WINDOW_ID";
+    }
+
+    if ((kind == Popup || kind == ModalPopup) && hashIds)
+    {
+        //popup ID is seeded by the caller, compute it once
+        os << ctx.ind << "if (!ID)\n";
+        ctx.ind_up();
+        os << ctx.ind << "ID = ImGui::GetID(\"###" << ctx.codeGen->GetName() << "\");\n";
+        ctx.ind_down();
+    }
+    else if (kind == Popup || kind == ModalPopup)
     {
         os << ctx.ind << "ID = ImGui::GetID(\"###" << ctx.codeGen->GetName() << "\");\n";
     }
@@ -726,8 +750,18 @@ void TopWindow::Export(std::ostream& os, UIContext& ctx)
     if (children.empty() || children[0]->userCodeBefore.empty())
         os << ctx.ind << "// TODO: Add Draw calls of dependent popup windows here\n\n";
 
-    for (const auto& ch : children)
-        ch->Export(os, ctx);
+    if (cullRows)
+    {
+        std::vector<Widget*> items;
+        for (const auto& ch : children)
+            items.push_back(ch.get());
+        ExportCulledChildren(os, ctx, items);
+    }
+    else
+    {
+        for (const auto& ch : children)
+            ch->Export(os, ctx);
+    }
 
     os << ctx.ind << "/// @separator\n";
 
@@ -766,6 +800,8 @@ void TopWindow::Export(std::ostream& os, UIContext& ctx)
         os << ctx.ind << "ImGui::PopFont();\n";
     
     os << ctx.ind << "/// @end TopWindow\n";
+    ctx.profile = false;
+    ctx.idSeed = "";
 
     if (userCodeAfter != "")
         os << userCodeAfter << "\n";
@@ -785,6 +821,7 @@ void TopWindow::Import(cpp::stmt_iterator& sit, UIContext& ctx)
     ctx.kind = kind = Window;
     bool hasGlfw = false;
     bool windowAppearingBlock = false;
+    bool cullBrace = false;
 
     while (sit != cpp::stmt_iterator())
     {
@@ -843,15 +880,29 @@ void TopWindow::Import(cpp::stmt_iterator& sit, UIContext& ctx)
                 sit.enable_parsing(true);
                 break;
             }
-            if (ctx.userCode != "")
-                ctx.userCode += "\n";
-            ctx.userCode += sit->line;
+            int cull = ctx.importState == 2 ? ImportCullCode(sit->line, cullBrace) : 0;
+            if (cull == 1)
+                cullRows = true;
+            else if (!cull) {
+                if (ctx.userCode != "")
+                    ctx.userCode += "\n";
+                ctx.userCode += sit->line;
+            }
         }
         else if ((sit->kind == cpp::IfCallThenCall && sit->cond == "ImRad::GetUserData().activeActivity==\"\"") ||
             (sit->kind == cpp::IfStmt && sit->cond == "ioUserData->activeActivity==\"\"")) //compatibility
         {
             initialActivity = true;
         }
+        else if (sit->kind == cpp::CallExpr && sit->callee == "IMRAD_PROFILE_SCOPE")
+        {
+            profile = true;
+        }
+        else if ((sit->kind == cpp::CallExpr && sit->callee == "ImRad::HashStr") ||
+            (sit->kind == cpp::IfStmt && sit->cond == "!ID"))
+        {
+            hashIds = true;
+        }
         else if (sit->kind == cpp::IfCallBlock && sit->callee == "ImGui::IsWindowAppearing")
         {
             windowAppearingBlock = true;
@@ -1068,7 +1119,14 @@ void TopWindow::Import(cpp::stmt_iterator& sit, UIContext& ctx)
     RenameFieldVars(std::string(ctx.codeGen->CUR_ITEM_VAR_NAME), CUR_ITEM_SYMBOL);
 }
 
-void TopWindow::TreeUI(UIContext& ctx)
+void TopWindow::TreeRows(std::vector<TreeRow>& rows, int level)
+{
+    rows.push_back({ this, level });
+    for (const auto& ch : children)
+        ch->TreeRows(rows, level + 1);
+}
+
+void TopWindow::TreeUI(const TreeRow& row, UIContext& ctx)
 {
     static const char* NAMES[]{ "MainWindow", "Window", "Popup", "ModalPopup", "Activity" };
 
@@ -1078,30 +1136,18 @@ void TopWindow::TreeUI(UIContext& ctx)
     if (selected)
         ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyle().Colors[ImGuiCol_ButtonHovered]);
     ImGui::SetNextItemOpen(true, ImGuiCond_Always);
-    if (ImGui::TreeNodeEx(str.c_str(), ImGuiTreeNodeFlags_SpanAllColumns))
+    ImGui::TreeNodeEx(str.c_str(), ImGuiTreeNodeFlags_SpanAllColumns | ImGuiTreeNodeFlags_NoTreePushOnOpen);
+    if (selected)
+        ImGui::PopStyleColor();
+    bool activated = ImGui::IsItemClicked(); //todo || ImGui::IsItemActivated();
+    ImGui::SameLine(0, 0);
+    ImGui::TextDisabled(" : %s", NAMES[kind]);
+    if (activated)
     {
-        if (selected)
-            ImGui::PopStyleColor();
-        bool activated = ImGui::IsItemClicked(); //todo || ImGui::IsItemActivated();
-        ImGui::SameLine(0, 0);
-        ImGui::TextDisabled(" : %s", NAMES[kind]);
-        if (activated)
-        {
-            if (ImGui::IsKeyDown(ImGuiKey_LeftCtrl) || ImGui::IsKeyDown(ImGuiKey_RightCtrl))
-                ; // don't participate in group selection toggle(ctx.selected, this);
-            else
-                ctx.selected = { this };
-        }
-        for (const auto& ch : children)
-            ch->TreeUI(ctx);
-
-        ImGui::TreePop();
-    }
-    else {
-        if (selected)
-            ImGui::PopStyleColor();
-        ImGui::SameLine(0, 0);
-        ImGui::TextDisabled(" : %s", NAMES[kind]);
+        if (ImGui::IsKeyDown(ImGuiKey_LeftCtrl) || ImGui::IsKeyDown(ImGuiKey_RightCtrl))
+            ; // don't participate in group selection toggle(ctx.selected, this);
+        else
+            ctx.selected = { this };
     }
 }
 
@@ -1127,6 +1173,9 @@ TopWindow::Properties()
         { "behavior.closeOnEscape", &closeOnEscape },
         { "behavior.initialActivity", &initialActivity },
         { "behavior.animate", &animate },
+        { "behavior.profile", &profile },
+        { "behavior.cullRows", &cullRows },
+        { "behavior.hashIds", &hashIds },
         { "layout.size.summary", nullptr },
         { "layout.size.size_x", &size_x },
         { "layout.size.size_y", &size_y },
@@ -1300,6 +1349,27 @@ bool TopWindow::PropertyUI(int i, UIContext& ctx)
         ImGui::EndDisabled();
         break;
     case 18:
+        ImGui::Text("profile");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        fl = profile != Defaults().profile ? InputDirectVal_Modified : 0;
+        changed = InputDirectVal(&profile, fl, ctx);
+        break;
+    case 19:
+        ImGui::Text("cullRows");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        fl = cullRows != Defaults().cullRows ? InputDirectVal_Modified : 0;
+        changed = InputDirectVal(&cullRows, fl, ctx);
+        break;
+    case 20:
+        ImGui::Text("hashIds");
+        ImGui::TableNextColumn();
+        ImGui::SetNextItemWidth(-ImGui::GetFrameHeight());
+        fl = hashIds != Defaults().hashIds ? InputDirectVal_Modified : 0;
+        changed = InputDirectVal(&hashIds, fl, ctx);
+        break;
+    case 21:
         ImGui::BeginDisabled((flags & ImGuiWindowFlags_AlwaysAutoResize) || placement == Maximize);
         ImGui::Text(kind == Activity ? "designSize" : "size");
         ImGui::TableNextColumn();
@@ -1310,7 +1380,7 @@ bool TopWindow::PropertyUI(int i, UIContext& ctx)
         ImGui::PopFont();
         ImGui::EndDisabled();
         break;
-    case 19:
+    case 22:
         ImGui::BeginDisabled((flags & ImGuiWindowFlags_AlwaysAutoResize) || placement == Maximize);
         ImGui::Text("size_x");
         ImGui::TableNextColumn();
@@ -1321,7 +1391,7 @@ bool TopWindow::PropertyUI(int i, UIContext& ctx)
         changed |= BindingButton("size_x", &size_x, ctx);
         ImGui::EndDisabled();
         break;
-    case 20:
+    case 23:
         ImGui::BeginDisabled((flags & ImGuiWindowFlags_AlwaysAutoResize) || placement == Maximize);
         ImGui::Text("size_y");
         ImGui::TableNextColumn();
@@ -1332,7 +1402,7 @@ bool TopWindow::PropertyUI(int i, UIContext& ctx)
         changed |= BindingButton("size_y", &size_y, ctx);
         ImGui::EndDisabled();
         break;
-    case 21:
+    case 24:
         ImGui::BeginDisabled((flags & ImGuiWindowFlags_AlwaysAutoResize) || kind == Activity);
         ImGui::Text("minimumSize");
         ImGui::TableNextColumn();
@@ -1343,7 +1413,7 @@ bool TopWindow::PropertyUI(int i, UIContext& ctx)
         ImGui::PopFont();
         ImGui::EndDisabled();
         break;
-    case 22:
+    case 25:
         ImGui::BeginDisabled((flags & ImGuiWindowFlags_AlwaysAutoResize) || kind == Activity);
         ImGui::Text("size_x");
         ImGui::TableNextColumn();
@@ -1354,7 +1424,7 @@ bool TopWindow::PropertyUI(int i, UIContext& ctx)
         changed |= BindingButton("minSize_x", &minSize_x, ctx);
         ImGui::EndDisabled();
         break;
-    case 23:
+    case 26:
         ImGui::BeginDisabled((flags & ImGuiWindowFlags_AlwaysAutoResize) || kind == Activity);
         ImGui::Text("size_y");
         ImGui::TableNextColumn();
@@ -1365,7 +1435,7 @@ bool TopWindow::PropertyUI(int i, UIContext& ctx)
         changed |= BindingButton("minSize_y", &minSize_y, ctx);
         ImGui::EndDisabled();
         break;
-    case 24:
+    case 27:
     {
         ImGui::BeginDisabled(kind == Activity);
         ImGui::Text("placement");
@@ -28,6 +28,9 @@ struct TopWindow : UINode
     direct_val<bool> closeOnEscape = false;
     direct_val<bool> animate = false;
     direct_val<bool> initialActivity = false;
+    direct_val<bool> profile = false; //emit IMRAD_PROFILE timers
+    direct_val<bool> cullRows = false; //skip rows scrolled out of view
+    direct_val<bool> hashIds = false; //compile-time window and child IDs
 
     event<> onBackButton;
     event<> onWindowAppearing;
@@ -37,7 +40,8 @@ struct TopWindow : UINode
     TopWindow(UIContext& ctx);
     void Draw(UIContext& ctx);
     void DrawTools(UIContext& ctx) {}
-    void TreeUI(UIContext& ctx);
+    void TreeRows(std::vector<TreeRow>& rows, int level);
+    void TreeUI(const TreeRow& row, UIContext& ctx);
     bool EventUI(int, UIContext& ctx);
     auto Properties() ->std::vector<Prop>;
     auto Events() ->std::vector<Prop>;
@@ -1,6 +1,10 @@
 #pragma once
 #include <algorithm>
+#include <string>
 #include <string_view>
+#include <istream>
+#include <ostream>
+#include <streambuf>
 
 namespace stx {
 
@@ -137,4 +141,89 @@ namespace stx {
     {
         return join(std::begin(c), std::end(c), sep);
     }
-}
\ No newline at end of file
+
+    //streambuf appending directly into a std::string
+    //unlike stringbuf there is no copy when taking the result and
+    //seekp/tellp still allow to overwrite already written text
+    struct string_buf : std::streambuf
+    {
+        std::string data;
+        size_t pos = 0;
+
+    protected:
+        int_type overflow(int_type c) override
+        {
+            if (traits_type::eq_int_type(c, traits_type::eof()))
+                return traits_type::not_eof(c);
+            char ch = traits_type::to_char_type(c);
+            xsputn(&ch, 1);
+            return c;
+        }
+        std::streamsize xsputn(const char* s, std::streamsize n) override
+        {
+            if (pos == data.size())
+                data.append(s, (size_t)n);
+            else
+                data.replace(pos, std::min((size_t)n, data.size() - pos), s, (size_t)n);
+            pos += (size_t)n;
+            return n;
+        }
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+        {
+            if (!(which & std::ios_base::out))
+                return pos_type(off_type(-1));
+            off_type base = dir == std::ios_base::beg ? 0 :
+                dir == std::ios_base::cur ? (off_type)pos : (off_type)data.size();
+            if (base + off < 0 || base + off > (off_type)data.size())
+                return pos_type(off_type(-1));
+            pos = (size_t)(base + off);
+            return pos_type((off_type)pos);
+        }
+        pos_type seekpos(pos_type p, std::ios_base::openmode which) override
+        {
+            return seekoff(off_type(p), std::ios_base::beg, which);
+        }
+    };
+
+    struct string_ostream : private string_buf, public std::ostream
+    {
+        string_ostream() : std::ostream(static_cast<string_buf*>(this)) {}
+        std::string& str() { return data; }
+        const std::string& str() const { return data; }
+        void reset() { data.clear(); pos = 0; std::ostream::clear(); }
+    };
+
+    //read-only streambuf over external memory like C++23 std::spanbuf
+    //the viewed data must outlive the stream
+    struct span_buf : std::streambuf
+    {
+        span_buf(std::string_view s)
+        {
+            char* p = const_cast<char*>(s.data());
+            setg(p, p, p + s.size());
+        }
+
+    protected:
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+        {
+            if (!(which & std::ios_base::in))
+                return pos_type(off_type(-1));
+            char* p = dir == std::ios_base::beg ? eback() :
+                dir == std::ios_base::cur ? gptr() : egptr();
+            if (off < eback() - p || off > egptr() - p)
+                return pos_type(off_type(-1));
+            setg(eback(), p + off, egptr());
+            return pos_type(off_type(gptr() - eback()));
+        }
+        pos_type seekpos(pos_type p, std::ios_base::openmode which) override
+        {
+            return seekoff(off_type(p), std::ios_base::beg, which);
+        }
+    };
+
+    struct ispanstream : private span_buf, public std::istream
+    {
+        ispanstream(std::string_view s) : span_buf(s), std::istream(static_cast<span_buf*>(this)) {}
+        std::string_view span() const { return { eback(), size_t(egptr() - eback()) }; }
+    };
+}
@@ -5,6 +5,8 @@
 #include "ui_new_field.h"
 #include "ui_message_box.h"
 #include "utils.h"
+#include <cctype>
+#include <cstring>
 
 BindingDlg bindingDlg;
 
@@ -75,7 +77,8 @@ void BindingDlg::Draw()
         /// @begin Input
         ImGui::PushFont(font, (0));
         ImGui::SetNextItemWidth(-1);
-        ImGui::InputText("##expr", &expr, ImGuiInputTextFlags_CallbackCharFilter, IMRAD_INPUTTEXT_EVENT(BindingDlg, OnTextInputFilter));
+        if (ImGui::InputText("##expr", &expr, ImGuiInputTextFlags_CallbackCharFilter, IMRAD_INPUTTEXT_EVENT(BindingDlg, OnTextInputFilter)))
+            OnExprChange();
         if (ImGui::IsItemActive())
             ImRad::GetUserData().imeType = ImRad::ImeText;
         ImGui::PopFont();
@@ -208,7 +211,19 @@ void BindingDlg::Draw()
 
 void BindingDlg::Refresh()
 {
-    vars = codeGen->GetVarExprs(showAll ? "" : type, true, curArray);
+    vars = codeGen->FindVarExprs(prefix, showAll ? "" : type, true, curArray);
+}
+
+//narrows the list to fields starting with the identifier being typed
+void BindingDlg::OnExprChange()
+{
+    size_t i = expr.size();
+    while (i && (std::isalnum((unsigned char)expr[i - 1]) || strchr("_.[]", expr[i - 1])))
+        --i;
+    if (expr.compare(i, std::string::npos, prefix)) {
+        prefix = expr.substr(i);
+        Refresh();
+    }
 }
 
 void BindingDlg::OnNewField()
@@ -242,6 +257,7 @@ int BindingDlg::OnTextInputFilter(ImGuiInputTextCallbackData& data)
 void BindingDlg::Init()
 {
     showAll = type == "std::string";
+    prefix = "";
     Refresh();
 }
 
@@ -18,6 +18,7 @@ public:
 
     void OnNewField();
     void OnVarClicked();
+    void OnExprChange();
     int OnTextInputFilter(ImGuiInputTextCallbackData& args);
     void Refresh();
 
@@ -41,6 +42,7 @@ private:
     ImRad::ModalResult modalResult;
     std::function<void(ImRad::ModalResult)> callback;
     bool showAll;
+    std::string prefix;
     std::vector<std::pair<std::string,std::string>> vars;
     bool focusExpr = false;
     ImRad::HBox hb1;
@@ -61,8 +61,7 @@ void ClassWizard::FindUsed(UINode* node, std::vector<std::string>& used)
         for (const auto& p : props) {
             if (!p.property)
                 continue;
-            auto vars = p.property->used_variables();
-            for (const auto& var : vars) {
+            for (const auto& var : p.property->used_vars()) {
                 assert(var.find_first_of("[.") == std::string::npos);
                 used.push_back(var);
             }
@@ -245,6 +245,19 @@ void SettingsDlg::Draw()
             ImGui::PopStyleVar();
             /// @end Combo
 
+            /// @begin Text
+            ImRad::Spacing(5);
+            ImGui::PushFont(nullptr, ::uiFontSize*1.1f);
+            ImGui::AlignTextToFramePadding();
+            ImGui::TextUnformatted("Code generation");
+            ImGui::PopFont();
+            /// @end Text
+
+            /// @begin CheckBox
+            ImRad::Spacing(1);
+            ImGui::Checkbox("cache parsed designs in .imrad-cache folder", &designCache);
+            /// @end CheckBox
+
             /// @separator
             ImGui::EndChild();
         }
@@ -21,6 +21,7 @@ public:
     std::string pgFontSize;
     std::string designFontName;
     std::string designFontSize;
+    bool designCache;
     /// @end interface
 
 private:
@@ -4,8 +4,12 @@
 
 UIContext& UIContext::Defaults()
 {
-    static UIContext ctx;
-    ctx.createVars = false;
+    //initialized once so it can be used from export worker threads
+    static UIContext ctx = [] {
+        UIContext tmp;
+        tmp.createVars = false;
+        return tmp;
+    }();
     return ctx;
 }
 
@@ -54,6 +54,7 @@ struct UIContext
     UINode* dragged = nullptr;
     ImVec2 lastSize;
     int importVersion;
+    bool loadTextures = true; //textures need the UI thread, off for async imports
     int importLevel;
     std::string userCode;
     UINode* root = nullptr;
@@ -70,6 +71,8 @@ struct UIContext
     ImVec2 selStart, selEnd;
     std::string ind;
     int varCounter;
+    bool profile = false; //TopWindow::profile during export
+    std::string idSeed; //constexpr ID of the exported window if known
     std::string parentVarName;
     std::vector<std::string> errors;
     ImVec2 stretchSize;
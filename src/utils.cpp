@@ -1,6 +1,7 @@
 #include "utils.h"
 #include "node_standard.h"
 #include "binding_input.h"
+#include <fstream>
 #if WIN32
 #define WIN32_LEAN_AND_MEAN
 #include <Windows.h>
@@ -248,4 +249,28 @@ bool path_cmp(const std::string& a, const std::string& b)
             return ca < cb;
     }
     return b.size() > a.size();
+}
+
+//writes into a temporary file first and renames it over the target
+//so readers never see partially written content
+bool WriteFileAtomic(const fs::path& path, std::string_view data, std::string& err, bool binary)
+{
+    fs::path tmp = path;
+    tmp += ".tmp";
+    std::ofstream fout(tmp, binary ? std::ios::trunc | std::ios::binary : std::ios::trunc);
+    if (!fout) {
+        err = "can't write to '" + u8string(path) + "'";
+        return false;
+    }
+    fout.write(data.data(), data.size());
+    fout.close();
+    std::error_code ec;
+    if (fout)
+        fs::rename(tmp, path, ec);
+    if (!fout || ec) {
+        fs::remove(tmp, ec);
+        err = "can't write to '" + u8string(path) + "'";
+        return false;
+    }
+    return true;
 }
\ No newline at end of file
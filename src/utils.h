@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 #include <imgui.h>
 #include <iostream>
 #include <vector>
@@ -93,6 +94,17 @@ inline void HashCombineData(ImU32& hash, T data)
     hash = ImHashData(&data, sizeof(data), hash);
 }
 
+//64-bit FNV-1a, keys the design cache by file content
+inline uint64_t HashContent(std::string_view data)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
 bool ShellExec(const std::string& path);
 
 int DefaultCharFilter(ImGuiInputTextCallbackData* data);
@@ -109,4 +121,5 @@ std::string Replace(std::string_view s, std::string_view sold, std::string_view
 fs::path u8path(std::string_view s);
 std::string u8string(const fs::path& p);
 std::string generic_u8string(const fs::path& p);
-bool path_cmp(const std::string& a, const std::string& b);
\ No newline at end of file
+bool path_cmp(const std::string& a, const std::string& b);
+bool WriteFileAtomic(const fs::path& path, std::string_view data, std::string& err, bool binary = false);
\ No newline at end of file
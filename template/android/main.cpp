@@ -1,3 +1,5 @@
+//compiles the out of line part of imrad.h, other sources include it as usual
+#define IMRAD_IMPLEMENTATION
 #include "imrad.h"
 #include "imgui/imgui.h"
 #include "imgui/backends/imgui_impl_android.h"
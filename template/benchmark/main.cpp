@@ -0,0 +1,193 @@
+//compiles the out of line part of imrad.h, other sources include it as usual
+#define IMRAD_IMPLEMENTATION
+#include "imrad.h"
+#include <imgui.h>
+#include <imgui_internal.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+// Headless benchmark of generated windows. No platform/renderer backend is used,
+// ImGui only builds draw lists which are measured and thrown away.
+// Enable "profile" on your windows and compile with IMRAD_WITH_PROFILER to also
+// get per container timings.
+//
+// usage: benchmark [frames] [size1 size2 ...]
+
+#ifdef IMRAD_BENCHMARK_SAMPLES
+//sample designs of the ImRAD repository, see benchmark/samples.cpp
+void Setup(int size);
+void Draw();
+#else
+//TODO: add your includes here
+
+//TODO: instantiate your windows here
+//MyDialog myDialog;
+
+void Setup(int size)
+{
+	// TODO: Fill bound containers with synthetic data of given size
+	//myDialog.items.resize(size);
+	//for (int i = 0; i < size; ++i)
+	//	myDialog.items[i] = "item " + std::to_string(i);
+
+	// TODO: Open your windows
+	//myDialog.Open();
+}
+
+void Draw()
+{
+	// TODO: Add your drawing code here
+	//myDialog.Draw();
+}
+#endif
+
+struct WindowStats
+{
+	int64_t vtx = 0;
+	int64_t idx = 0;
+	int64_t cmds = 0;
+};
+
+//draw lists of child windows and popups are counted under their root window
+static void CollectStats(std::map<std::string, WindowStats>& stats)
+{
+	ImGuiContext& g = *ImGui::GetCurrentContext();
+	for (ImGuiWindow* window : g.Windows)
+	{
+		if (!window->WasActive || window->Hidden)
+			continue;
+		const ImDrawList* dl = window->DrawList;
+		auto& st = stats[window->RootWindow->Name];
+		st.vtx += dl->VtxBuffer.Size;
+		st.idx += dl->IdxBuffer.Size;
+		st.cmds += dl->CmdBuffer.Size;
+	}
+}
+
+//acknowledge texture requests as a real renderer would
+static void UpdateTextures(ImDrawData* drawData)
+{
+	if (!drawData->Textures)
+		return;
+	for (ImTextureData* tex : *drawData->Textures)
+	{
+		if (tex->Status == ImTextureStatus_WantCreate) {
+			tex->SetTexID((ImTextureID)(intptr_t)(tex->UniqueID + 1));
+			tex->SetStatus(ImTextureStatus_OK);
+		}
+		else if (tex->Status == ImTextureStatus_WantUpdates)
+			tex->SetStatus(ImTextureStatus_OK);
+		else if (tex->Status == ImTextureStatus_WantDestroy) {
+			tex->SetTexID(ImTextureID_Invalid);
+			tex->SetStatus(ImTextureStatus_Destroyed);
+		}
+	}
+}
+
+static double Percentile(std::vector<double>& v, double p)
+{
+	if (v.empty())
+		return 0;
+	size_t i = std::min(v.size() - 1, (size_t)(p * v.size()));
+	std::nth_element(v.begin(), v.begin() + i, v.end());
+	return v[i];
+}
+
+static void RunBenchmark(int size, int frames)
+{
+	const int WARMUP = 10;
+	ImGuiIO& io = ImGui::GetIO();
+	Setup(size);
+
+	std::vector<double> times;
+	times.reserve(frames);
+	std::map<std::string, WindowStats> stats;
+	for (int i = 0; i < WARMUP + frames; ++i)
+	{
+		io.DeltaTime = 1.f / 60;
+		auto start = std::chrono::steady_clock::now();
+		ImGui::NewFrame();
+		Draw();
+		ImGui::Render();
+		auto end = std::chrono::steady_clock::now();
+		UpdateTextures(ImGui::GetDrawData());
+
+		if (i < WARMUP)
+			continue;
+		times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+		CollectStats(stats);
+	}
+
+	double sum = 0;
+	for (double t : times)
+		sum += t;
+	double avg = sum / frames;
+	double p50 = Percentile(times, 0.5);
+	double p99 = Percentile(times, 0.99);
+	double max = *std::max_element(times.begin(), times.end());
+	printf("size %d: avg %.3f ms, p50 %.3f ms, p99 %.3f ms, max %.3f ms\n", size, avg, p50, p99, max);
+
+	printf("  %-32s %10s %10s %10s\n", "window", "vtx", "idx", "cmds");
+	for (const auto& st : stats)
+	{
+		if (!st.first.compare(0, 7, "Debug##"))
+			continue;
+		printf("  %-32s %10lld %10lld %10lld\n", st.first.c_str(),
+			(long long)(st.second.vtx / frames),
+			(long long)(st.second.idx / frames),
+			(long long)(st.second.cmds / frames));
+	}
+
+#ifdef IMRAD_WITH_PROFILER
+	auto& reg = ImRad::GetProfileRegistry();
+	int n = std::min(reg.count.load(), ImRad::ProfileRegistry::MAX_ENTRIES);
+	for (int i = 0; i < n; ++i)
+	{
+		const auto& e = reg.entries[i];
+		const char* name = e.name.load();
+		int head = e.head.load();
+		if (!name || !head)
+			continue;
+		int cnt = std::min({ head, frames, ImRad::ProfileEntry::HISTORY });
+		int64_t esum = 0;
+		for (int j = 0; j < cnt; ++j)
+			esum += e.history[(head - 1 - j) % ImRad::ProfileEntry::HISTORY].load();
+		printf("  %-32s %10.3f ms\n", name, esum / 1e6 / cnt);
+	}
+#endif
+	printf("\n");
+}
+
+int main(int argc, const char* argv[])
+{
+	int frames = argc > 1 ? std::max(1, atoi(argv[1])) : 500;
+	std::vector<int> sizes;
+	for (int i = 2; i < argc; ++i)
+		sizes.push_back(atoi(argv[i]));
+	if (sizes.empty())
+		sizes = { 10, 100, 1000, 10000 };
+
+	// Setup Dear ImGui context
+	IMGUI_CHECKVERSION();
+	ImGui::CreateContext();
+	ImGuiIO& io = ImGui::GetIO();
+	io.IniFilename = nullptr;
+	io.DisplaySize = { 1280, 720 };
+	io.BackendRendererName = "imrad_null";
+	io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+
+	// TODO: Load the same style and fonts as your application
+	//ImRad::LoadStyle("my-style.ini");
+	ImGui::StyleColorsDark();
+
+	for (int size : sizes)
+		RunBenchmark(size, frames);
+
+	ImGui::DestroyContext();
+	return 0;
+}
@@ -1,3 +1,5 @@
+//compiles the out of line part of imrad.h, other sources include it as usual
+#define IMRAD_IMPLEMENTATION
 #include "imrad.h"
 #include <imgui.h>
 //#include <IconsFontAwesome6.h>
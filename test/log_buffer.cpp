@@ -0,0 +1,51 @@
+#include "imrad_feed.h"
+#include <deque>
+#include <cstdio>
+
+//stored lines must equal the most recently appended ones
+static bool Check(ImRad::LogBuffer& log, const std::deque<std::string>& appended, const char* what)
+{
+    size_t n = log.Size();
+    if (n > appended.size()) {
+        printf("%s: %zu lines stored, %zu appended\n", what, n, appended.size());
+        return false;
+    }
+    for (size_t i = 0; i < n; ++i)
+    {
+        const std::string& expected = appended[appended.size() - n + i];
+        if (log[i] != expected) {
+            printf("%s: line %zu is \"%s\", expected \"%s\"\n", what, i, log[i].c_str(), expected.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+int main()
+{
+    ImRad::LogBuffer log(100, 1000);
+    std::deque<std::string> appended;
+    auto append = [&](size_t len) {
+        std::string s(len, 'a' + appended.size() % 26);
+        log.Append(s);
+        appended.push_back(s);
+    };
+
+    //second wrap leaves the oldest lines at the end of the buffer
+    for (int i = 0; i < 9; ++i)
+        append(10);
+    append(5);
+    for (int i = 0; i < 9; ++i)
+        append(10);
+    append(20);
+    if (!Check(log, appended, "wrap"))
+        return 1;
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        append((i * 7919) % 26);
+        if (!Check(log, appended, "mixed sizes"))
+            return 1;
+    }
+    return 0;
+}